@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_helpers.hpp>
+
+/** benchmarks the limb kernels of boost::real::exact_number
+ *  for a varying number of limbs
+ */
+
+const int MIN_NUM_LIMBS_AS = 1;
+const int MAX_NUM_LIMBS_AS = 100000;
+const int MULTIPLIER_AS = 10;  // for range evaluation of addition/subtraction benchmarks
+
+/// benchmarks add_vector for two numbers of n limbs whose exponents line up (in place path)
+void BM_ExactNumberAlignedAddition(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.add_vector(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberAlignedAddition)
+    ->RangeMultiplier(MULTIPLIER_AS)->Range(MIN_NUM_LIMBS_AS, MAX_NUM_LIMBS_AS)
+    ->Complexity(benchmark::oN);
+
+/// benchmarks add_vector for two numbers of n limbs shifted by half their length
+void BM_ExactNumberShiftedAddition(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(state.range(0), 536870911, state.range(0) / 2);
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.add_vector(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberShiftedAddition)
+    ->RangeMultiplier(MULTIPLIER_AS)->Range(MIN_NUM_LIMBS_AS, MAX_NUM_LIMBS_AS)
+    ->Complexity(benchmark::oN);
+
+/// benchmarks subtract_vector for two numbers of n limbs whose exponents line up (in place path)
+void BM_ExactNumberAlignedSubtraction(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(state.range(0), 123456789, state.range(0));
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.subtract_vector(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberAlignedSubtraction)
+    ->RangeMultiplier(MULTIPLIER_AS)->Range(MIN_NUM_LIMBS_AS, MAX_NUM_LIMBS_AS)
+    ->Complexity(benchmark::oN);
+
+/// benchmarks subtract_vector for two numbers of n limbs shifted by half their length
+void BM_ExactNumberShiftedSubtraction(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(state.range(0), 123456789, state.range(0) / 2);
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.subtract_vector(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberShiftedSubtraction)
+    ->RangeMultiplier(MULTIPLIER_AS)->Range(MIN_NUM_LIMBS_AS, MAX_NUM_LIMBS_AS)
+    ->Complexity(benchmark::oN);
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_helpers.hpp>
+
+/** benchmarks the multiplication algorithms of boost::real::exact_number
+ *  for operands of a varying number of limbs
+ */
+
+const int MIN_NUM_LIMBS_MUL = 1000;
+const int MAX_NUM_LIMBS_MUL = 1000000;
+const int MULTIPLIER_MUL = 10;  // for range evaluation of multiplication benchmarks
+
+/// benchmarks karatsuba_multiplication of two numbers of n limbs
+void BM_ExactNumberKaratsubaMultiplication(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(state.range(0), 123456789, state.range(0));
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.karatsuba_multiplication(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberKaratsubaMultiplication)
+    ->RangeMultiplier(MULTIPLIER_MUL)->Range(MIN_NUM_LIMBS_MUL, MAX_NUM_LIMBS_MUL)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+/// benchmarks ntt_multiplication of two numbers of n limbs
+void BM_ExactNumberNTTMultiplication(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(state.range(0), 123456789, state.range(0));
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.ntt_multiplication(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberNTTMultiplication)
+    ->RangeMultiplier(MULTIPLIER_MUL)->Range(MIN_NUM_LIMBS_MUL, MAX_NUM_LIMBS_MUL)->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oNLogN);
+
+/// benchmarks karatsuba_square of a number of n limbs, to compare with BM_ExactNumberKaratsubaMultiplication
+void BM_ExactNumberKaratsubaSquare(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    std::vector<int> scratch;
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.karatsuba_square(scratch);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberKaratsubaSquare)
+    ->RangeMultiplier(MULTIPLIER_MUL)->Range(MIN_NUM_LIMBS_MUL, MAX_NUM_LIMBS_MUL)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+/// benchmarks multiply_vector of a number of n limbs by a number of 200 limbs, multiplied in chunks
+void BM_ExactNumberUnbalancedMultiplication(benchmark::State& state) {
+    boost::real::exact_number<int> a = exactNumberOfLimbs(state.range(0), 536870911, state.range(0));
+    boost::real::exact_number<int> b = exactNumberOfLimbs(200, 123456789, 200);
+
+    for (auto i : state) {
+        state.PauseTiming();
+        boost::real::exact_number<int> result = a;
+        state.ResumeTiming();
+
+        result.multiply_vector(b);
+        benchmark::DoNotOptimize(result.digits.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ExactNumberUnbalancedMultiplication)
+    ->RangeMultiplier(MULTIPLIER_MUL)->Range(MIN_NUM_LIMBS_MUL, MAX_NUM_LIMBS_MUL)->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
@@ -45,4 +45,9 @@ constexpr bool realComp(boost::real::real<>& lhs, boost::real::real<>& rhs, Comp
     }
 }
 
+/// builds an exact_number of n limbs, all of them set to digit, with the given exponent
+inline boost::real::exact_number<int> exactNumberOfLimbs(int n, int digit, int exponent) {
+    return boost::real::exact_number<int>(std::vector<int>(n, digit), exponent, true);
+}
+
 #endif // BOOST_REAL_BENCHMARK_HELPERS_HPP
\ No newline at end of file
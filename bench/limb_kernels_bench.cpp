@@ -0,0 +1,75 @@
+#include <chrono>
+#include <benchmark/benchmark.h>
+#include <benchmark_helpers.hpp>
+
+/** benchmarks the vector limb kernels of boost::real::exact_number against their scalar loops
+ *  for a varying number of limbs. The reported time is the one of the kernels picked at run time,
+ *  the speedup counter is the time of the scalar loops over it (1 on CPUs without AVX2)
+ */
+
+const int MIN_NUM_LIMBS_LK = 16;
+const int MAX_NUM_LIMBS_LK = 16384;
+const int MULTIPLIER_LK = 4;  // for range evaluation of limb kernel benchmarks
+
+enum class LimbKernel {ADDITION, SUBTRACTION, COMPARISON, MULTIPLICATION};
+
+/// runs kernel once with the vector kernels and once with the scalar loops per iteration
+void BM_LimbKernel(benchmark::State& state, LimbKernel kernel) {
+    using exact_number = boost::real::exact_number<int>;
+    const int base = (std::numeric_limits<int>::max() / 4) * 2;
+    const size_t n = state.range(0);
+    // the multiplication kernel is a schoolbook product, timed on a row of n limbs by 64 limbs
+    const size_t m = 64;
+
+    std::vector<int> a = exactNumberOfLimbs(n, 536870911, n).digits;
+    std::vector<int> b = exactNumberOfLimbs(std::max(n, m), 123456789, n).digits;
+    std::vector<int> result(n + m);
+
+    auto run = [&](bool simd) {
+        boost::real::detail::use_simd_kernels() = simd;
+        std::copy(a.begin(), a.end(), result.begin());
+        auto start = std::chrono::high_resolution_clock::now();
+        switch (kernel) {
+            case LimbKernel::ADDITION:
+                benchmark::DoNotOptimize(exact_number::add_in_place(result.data(), b.data(), n, base - 1));
+                break;
+            case LimbKernel::SUBTRACTION:
+                benchmark::DoNotOptimize(exact_number::subtract_in_place(result.data(), b.data(), n, base - 1));
+                break;
+            case LimbKernel::COMPARISON:
+                benchmark::DoNotOptimize(exact_number::compare_spans(a.data(), n, a.data(), n));
+                break;
+            case LimbKernel::MULTIPLICATION:
+                exact_number::multiply_basecase(result.data(), a.data(), n, b.data(), m, base);
+                break;
+        }
+        benchmark::DoNotOptimize(result.data());
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    };
+
+    const bool simd = boost::real::detail::use_simd_kernels();
+    double vector_time = 0, scalar_time = 0;
+    for (auto i : state) {
+        double elapsed = run(simd);
+        scalar_time += run(false);
+        vector_time += elapsed;
+        state.SetIterationTime(elapsed);
+    }
+    boost::real::detail::use_simd_kernels() = simd;
+
+    state.counters["speedup"] = (vector_time > 0) ? scalar_time / vector_time : 1.0;
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_CAPTURE(BM_LimbKernel, addition, LimbKernel::ADDITION)
+    ->RangeMultiplier(MULTIPLIER_LK)->Range(MIN_NUM_LIMBS_LK, MAX_NUM_LIMBS_LK)->UseManualTime()
+    ->Complexity(benchmark::oN);
+BENCHMARK_CAPTURE(BM_LimbKernel, subtraction, LimbKernel::SUBTRACTION)
+    ->RangeMultiplier(MULTIPLIER_LK)->Range(MIN_NUM_LIMBS_LK, MAX_NUM_LIMBS_LK)->UseManualTime()
+    ->Complexity(benchmark::oN);
+BENCHMARK_CAPTURE(BM_LimbKernel, comparison, LimbKernel::COMPARISON)
+    ->RangeMultiplier(MULTIPLIER_LK)->Range(MIN_NUM_LIMBS_LK, MAX_NUM_LIMBS_LK)->UseManualTime()
+    ->Complexity(benchmark::oN);
+BENCHMARK_CAPTURE(BM_LimbKernel, multiplication, LimbKernel::MULTIPLICATION)
+    ->RangeMultiplier(MULTIPLIER_LK)->Range(MIN_NUM_LIMBS_LK, MAX_NUM_LIMBS_LK)->UseManualTime()
+    ->Complexity(benchmark::oN);
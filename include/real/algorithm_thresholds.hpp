@@ -0,0 +1,71 @@
+#ifndef BOOST_REAL_ALGORITHM_THRESHOLDS_HPP
+#define BOOST_REAL_ALGORITHM_THRESHOLDS_HPP
+
+#include <real/limb_kernels.hpp>
+
+namespace boost {
+    namespace real {
+
+        /// the operand lengths, in limbs, where exact_number moves from one algorithm to the next
+        struct threshold_set {
+            int karatsuba_base_case;  // schoolbook -> karatsuba
+            int karatsuba_square;     // schoolbook square -> karatsuba square
+            int karatsuba_unbalanced; // chunked karatsuba of unbalanced operands, below it schoolbook
+            int toom_3;               // karatsuba -> toom-3
+            int toom_4;               // toom-3 -> toom-4
+            int ntt;                  // toom -> number theoretic transform
+            int ntt_unbalanced;       // shorter operand of an unbalanced product that goes to the transform
+            int burnikel_ziegler;     // knuth division -> recursive division
+            int newton_division;      // knuth / recursive division -> newton division
+            int binary_splitting;     // precision of a series summed term by term -> by binary splitting
+            int half_gcd;             // integer_number gcd by lehmer steps -> by the recursive half gcd
+            int lazy_rational;        // limbs of both real_rational operands below which results stay unreduced, 0 reduces all
+        };
+
+        /**
+         *  @brief: THRESHOLD DEFAULTS: the thresholds a limb type starts with. The primary template holds
+         *          the measured defaults of a generic x86-64 machine, the vector schoolbook product of
+         *          limb_kernels.hpp is several times faster than the scalar one, which moves the crossovers
+         *          to karatsuba and to the NTT up.
+         *
+         *          tuned_thresholds.hpp, included below, specializes it for the limb types the real_tune
+         *          target measured on this machine.
+         */
+        template <typename T>
+        struct threshold_defaults {
+            static threshold_set get() {
+                const bool simd = detail::use_simd_kernels();
+                return {simd ? 32 : 12, 24, 100, 1500, 2500, simd ? 5000 : 3000, simd ? 1500 : 300, 24, 1000, 2, 200, 0};
+            }
+        };
+    }
+}
+
+#include <real/tuned_thresholds.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         *  @brief: ALGORITHM THRESHOLDS: the thresholds exact_number<T> reads, one set per limb type. They
+         *          start at threshold_defaults<T> on first use and can be changed at run time, by hand or by
+         *          tune_thresholds<T>() of tuning.hpp. The set is a static of an inline function, so every
+         *          translation unit shares it, and it is initialized before the first product that needs
+         *          it, even one running in the initializer of a global.
+         */
+        template <typename T>
+        struct algorithm_thresholds {
+            static threshold_set &get() {
+                static threshold_set thresholds = threshold_defaults<T>::get();
+                return thresholds;
+            }
+
+            /// replaces all the thresholds
+            static void set(const threshold_set &thresholds) {
+                get() = thresholds;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_ALGORITHM_THRESHOLDS_HPP
@@ -140,7 +140,7 @@ namespace boost {
                 explicit const_precision_iterator(real_number<T> * a) : _real_ptr(std::make_shared<real_number<T>>(*a)), _precision(1) {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                            T base = limb_traits<T>::max_digit;
                             this->_approximation_interval.lower_bound.exponent = real.exponent();
                             this->_approximation_interval.upper_bound.exponent = real.exponent();
                             this->_approximation_interval.lower_bound.positive = real.positive();
@@ -161,7 +161,7 @@ namespace boost {
                         },
 
                         [this] (real_algorithm<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                            T base = limb_traits<T>::max_digit;
                             this->_approximation_interval.lower_bound.exponent = real.exponent();
                             this->_approximation_interval.upper_bound.exponent = real.exponent();
                             this->_approximation_interval.lower_bound.positive = real.positive();
@@ -186,7 +186,8 @@ namespace boost {
                             },
 
                         [this] (real_rational<T> &real){
-                            if(real.b == integer_number<T>("1")){
+                            real.normalize();
+                            if(real.b == literals::one_integer<T>){
                                 real_number<T> tmp_num = real_number<T>(real_explicit<T>(real.a));
                                 (*this) = const_precision_iterator(std::make_shared<real_number<T>>(tmp_num));
                             }
@@ -208,7 +209,7 @@ namespace boost {
                 explicit const_precision_iterator(std::shared_ptr<real_number<T>>  a) : _real_ptr(a), _precision(1) {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                            T base = limb_traits<T>::max_digit;
                             this->_approximation_interval.lower_bound.exponent = real.exponent();
                             this->_approximation_interval.upper_bound.exponent = real.exponent();
                             this->_approximation_interval.lower_bound.positive = real.positive();
@@ -229,7 +230,7 @@ namespace boost {
                         },
 
                         [this] (real_algorithm<T>& real) {
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                            T base = limb_traits<T>::max_digit;
                             this->_approximation_interval.lower_bound.exponent = real.exponent();
                             this->_approximation_interval.upper_bound.exponent = real.exponent();
                             this->_approximation_interval.lower_bound.positive = real.positive();
@@ -340,7 +341,7 @@ namespace boost {
                             if (this->_precision >= real.digits().size()) {
                                 return;
                             }
-                            T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                            T base = limb_traits<T>::max_digit;
                            // If the number is negative, boundaries are interpreted as mirrored:
                            // First, the operation is made as positive, and after boundary calculation
                            // boundaries are swapped to come back to the negative representation.
@@ -395,7 +396,7 @@ namespace boost {
                            // If the number is negative, bounds are interpreted as mirrored:
                            // First, the operation is made as positive, and after bound calculation
                            // bounds are swapped to come back to the negative representation.
-                           T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                           T base = limb_traits<T>::max_digit;
                            this->check_and_swap_boundaries();
 
                            for (int i = 0; i < n; i++) {
@@ -224,7 +224,7 @@ void append_digits(std::vector<T1> &number, T1 num_base, std::vector<T2> &digits
  **/
 // Algorithm to multiply two vectors.
 template<typename T>
-std::vector<T> multiply(std::vector<T> &a, std::vector<T> &b, T base = (std::numeric_limits<T>::max() / 4) * 2 -1)
+std::vector<T> multiply(const std::vector<T> &a, const std::vector<T> &b, T base = boost::real::limb_traits<T>::max_digit)
 {
     std::vector<T> temp;
     size_t new_size = a.size() + b.size();
@@ -6,32 +6,50 @@
 #include <sstream>
 #include <algorithm>
 #include <math.h>
+#include <cmath>
 #include <type_traits>
 #include <limits>
 #include <iterator>
 #include <cctype>
+#include <tuple>
+#include <string_view>
+#include <real/real_exception.hpp>
+#include <real/limb_traits.hpp>
+#include <real/limb_kernels.hpp>
+#include <real/algorithm_thresholds.hpp>
+#include <real/small_vector.hpp>
+#include <real/ntt.hpp>
 
 namespace boost {
     namespace real {
 
-        int KARATSUBA_BASE_CASE_THRESHOLD = 100;
+// number of digits an exact_number keeps without allocating, 0 stores them in a plain std::vector
+#ifndef BOOST_REAL_INLINE_DIGITS
+#define BOOST_REAL_INLINE_DIGITS 16
+#endif
 
         template <typename T = int>
         struct exact_number {
             using exponent_t = int;
 
-            // TODO: replace all redundant declarations of base with this
-            // static const T BASE = ;
+            /// the digit container, short numbers (as the bounds at the default precision) stay inline
+            using digits_type = typename std::conditional<BOOST_REAL_INLINE_DIGITS == 0,
+                    std::vector<T>, small_vector<T, (BOOST_REAL_INLINE_DIGITS > 0 ? BOOST_REAL_INLINE_DIGITS : 1)>>::type;
 
-            std::vector<T> digits = {};
+            digits_type digits = {};
             exponent_t exponent = 0;
             bool positive = true;
 
-            static bool aligned_vectors_is_lower(const std::vector<T> &lhs, const std::vector<T> &rhs, bool equal = false) {
+            static bool aligned_vectors_is_lower(const digits_type &lhs, const digits_type &rhs, bool equal = false) {
 
                 // Check if lhs is lower than rhs
                 auto lhs_it = lhs.cbegin();
                 auto rhs_it = rhs.cbegin();
+                size_t common = 0;
+                if (detail::simd_mismatch(lhs.data(), rhs.data(), std::min(lhs.size(), rhs.size()), common)) {
+                    lhs_it += common;
+                    rhs_it += common;
+                }
                 while (rhs_it != rhs.end() && lhs_it != lhs.end() && *lhs_it == *rhs_it) {
                     ++lhs_it;
                     ++rhs_it;
@@ -44,246 +62,1142 @@ namespace boost {
                 if (equal && rhs_it == rhs.cend() && lhs_it == lhs.cend())
                     return false;
 
-                bool lhs_all_zero = std::all_of(lhs_it, lhs.cend(), [](int i){ return i == 0; });
-                bool rhs_all_zero = std::all_of(rhs_it, rhs.cend(), [](int i){ return i == 0; });
+                bool lhs_all_zero = std::all_of(lhs_it, lhs.cend(), [](T i){ return i == 0; });
+                bool rhs_all_zero = std::all_of(rhs_it, rhs.cend(), [](T i){ return i == 0; });
 
                 return lhs_all_zero && !rhs_all_zero;
             }
 
-            /// adds other to *this. disregards sign -- that's taken care of in the operators.
-            void add_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
-                int carry = 0;
-                std::vector<T> temp;
-                int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
-                int integral_length = std::max(this->exponent, other.exponent);
+            /**
+             *  @brief: adds the aligned digit span b to the digit span r in place, walking from the
+             *          lowest to the highest digit in a single carry propagating pass.
+             *  @param: r: first digit of the accumulator, most significant digit first
+             *  @param: b: first digit of the addend, most significant digit first
+             *  @param: n: number of digits in both spans
+             *  @param: max_digit: greatest digit allowed in the base, i.e. base - 1
+             *  @return: the carry out of r[0] (0 or 1)
+             */
+            static T add_in_place(T* r, const T* b, size_t n, T max_digit) {
+                T carry = 0;
+                if (detail::simd_add_in_place(r, b, n, max_digit, carry)) {
+                    return carry;
+                }
+                for (size_t i = n; i-- > 0;) {
+                    // r[i] + b[i] + carry <= 2 * max_digit + 1, which always fits in T
+                    T sum = r[i] + b[i] + carry;
+                    carry = (sum > max_digit);
+                    r[i] = carry ? sum - max_digit - 1 : sum;
+                }
+                return carry;
+            }
 
-                // we walk the numbers from the lowest to the highest digit
-                for (int i = fractional_length - 1; i >= -integral_length; i--) {
+            /**
+             *  @brief: subtracts the aligned digit span b from the digit span r in place, walking from
+             *          the lowest to the highest digit in a single borrow propagating pass.
+             *  @param: r: first digit of the minuend, most significant digit first
+             *  @param: b: first digit of the subtrahend, most significant digit first
+             *  @param: n: number of digits in both spans
+             *  @param: max_digit: greatest digit allowed in the base, i.e. base - 1
+             *  @return: the borrow out of r[0] (0 or 1)
+             */
+            static T subtract_in_place(T* r, const T* b, size_t n, T max_digit) {
+                T borrow = 0;
+                if (detail::simd_subtract_in_place(r, b, n, max_digit, borrow)) {
+                    return borrow;
+                }
+                for (size_t i = n; i-- > 0;) {
+                    // b[i] + borrow <= max_digit + 1, so the subtrahend never overflows
+                    T sub = b[i] + borrow;
+                    if (r[i] >= sub) {
+                        r[i] -= sub;
+                        borrow = 0;
+                    } else {
+                        r[i] += (max_digit - sub) + 1;
+                        borrow = 1;
+                    }
+                }
+                return borrow;
+            }
 
-                    T lhs_digit = 0;
-                    if (0 <= this->exponent + i && this->exponent + i < (int)this->digits.size()) {
-                        lhs_digit = this->digits[this->exponent + i];
+            /// adds carry to the digit span r[0..n) from its lowest digit up, returns the carry out of r[0]
+            static T propagate_carry(T* r, size_t n, T carry, T max_digit) {
+                for (size_t i = n; carry != 0 && i-- > 0;) {
+                    if (r[i] == max_digit) {
+                        r[i] = 0;
+                    } else {
+                        ++r[i];
+                        carry = 0;
                     }
+                }
+                return carry;
+            }
 
-                    T rhs_digit = 0;
-                    if (0 <= other.exponent + i && other.exponent + i < (int)other.digits.size()) {
-                        rhs_digit = other.digits[other.exponent + i];
+            /// subtracts borrow from the digit span r[0..n) from its lowest digit up, returns the borrow out of r[0]
+            static T propagate_borrow(T* r, size_t n, T borrow, T max_digit) {
+                for (size_t i = n; borrow != 0 && i-- > 0;) {
+                    if (r[i] == 0) {
+                        r[i] = max_digit;
+                    } else {
+                        --r[i];
+                        borrow = 0;
                     }
-                    
-                    T digit;
-                    int orig_carry = carry;
-                    carry = 0;
-                    if ((base - lhs_digit) < rhs_digit) {
-                        T min = std::min(lhs_digit, rhs_digit);
-                        T max = std::max(lhs_digit, rhs_digit);
-                        if (min <= base/2) {
-                            T remaining = base/2 - min;
-                            digit = (max - base/2) - remaining - 2;
+                }
+                return borrow;
+            }
+
+            /**
+             *  @brief: multiplies the digit span r[0..n) by a single digit factor in place, walking from the
+             *          lowest to the highest digit.
+             *  @param: r: first digit of the number, most significant digit first
+             *  @param: n: number of digits
+             *  @param: factor: the multiplier, lower than base
+             *  @param: base: base of the digits
+             *  @return: the carry out of r[0], lower than factor
+             */
+            static T multiply_by_small_in_place(T* r, size_t n, T factor, T base) {
+                T carry = 0;
+                for (size_t i = n; i-- > 0;) {
+                    if constexpr (limb_traits<T>::has_wide_type) {
+                        using wide_type = typename limb_traits<T>::wide_type;
+                        wide_type t = (wide_type) r[i] * (wide_type) factor + (wide_type) carry;
+                        r[i] = (T) (t % (wide_type) base);
+                        carry = (T) (t / (wide_type) base);
+                    } else {
+                        T rem = mul_mod(r[i], factor, base);
+                        T q = mult_div(r[i], factor, base);
+                        if (rem >= base - carry) {
+                            rem -= base - carry;
+                            ++q;
                         } else {
-                            digit = (min - base/2) + (max - base/2) - 2;
+                            rem += carry;
                         }
-                        carry = 1;
+                        r[i] = rem;
+                        carry = q;
                     }
-                    else {
-                        carry = 0;
-                        digit = rhs_digit + lhs_digit;
+                }
+                return carry;
+            }
+
+            /**
+             *  @brief: r[0..n) += a[0..n) * factor for a single digit factor, in one pass from the lowest
+             *          digit, the row of a schoolbook product added where it lands.
+             *  @return: the carry out of r[0], a digit
+             */
+            static T add_mul_small_in_place(T* r, const T* a, size_t n, T factor, T base) {
+                T carry = 0;
+                for (size_t i = n; i-- > 0;) {
+                    if constexpr (limb_traits<T>::has_wide_type) {
+                        using wide_type = typename limb_traits<T>::wide_type;
+                        // (base - 1) * (base - 1) + 2 * (base - 1) < base^2
+                        wide_type t = (wide_type) a[i] * (wide_type) factor + (wide_type) r[i] + (wide_type) carry;
+                        r[i] = (T) (t % (wide_type) base);
+                        carry = (T) (t / (wide_type) base);
+                    } else {
+                        T sum = mul_mod(a[i], factor, base);
+                        T high = mult_div(a[i], factor, base);
+                        // r[i] + sum < 2 * base, which always fits in T
+                        sum += r[i];
+                        if (sum >= base) {
+                            sum -= base;
+                            ++high;
+                        }
+                        if (sum >= base - carry) {
+                            sum -= base - carry;
+                            ++high;
+                        } else {
+                            sum += carry;
+                        }
+                        r[i] = sum;
+                        carry = high;
                     }
-                    if (digit < base || orig_carry == 0) {
-                        digit += orig_carry;
+                }
+                return carry;
+            }
+
+            /**
+             *  @brief: r[0..n) -= a[0..n) * factor for a single digit factor, the counterpart of
+             *          add_mul_small_in_place.
+             *  @return: the borrow out of r[0], a digit
+             */
+            static T subtract_mul_small_in_place(T* r, const T* a, size_t n, T factor, T base) {
+                T borrow = 0;
+                for (size_t i = n; i-- > 0;) {
+                    T low, high;
+                    if constexpr (limb_traits<T>::has_wide_type) {
+                        using wide_type = typename limb_traits<T>::wide_type;
+                        wide_type t = (wide_type) a[i] * (wide_type) factor + (wide_type) borrow;
+                        low = (T) (t % (wide_type) base);
+                        high = (T) (t / (wide_type) base);
+                    } else {
+                        low = mul_mod(a[i], factor, base);
+                        high = mult_div(a[i], factor, base);
+                        if (low >= base - borrow) {
+                            low -= base - borrow;
+                            ++high;
+                        } else {
+                            low += borrow;
+                        }
                     }
-                    else {
-                        carry = 1;
-                        digit = 0;
+                    if (r[i] < low) {
+                        r[i] += base - low;
+                        ++high;
+                    } else {
+                        r[i] -= low;
                     }
-                    temp.insert(temp.begin(), digit);
+                    borrow = high;
                 }
-                if (carry == 1) {
-                    temp.insert(temp.begin(), 1);
-                    integral_length++;
+                return borrow;
+            }
+
+            /// adds the digit carry to r[n - 1] and carries on up, returns the carry out of r[0]
+            static T add_digit_in_place(T* r, size_t n, T carry, T max_digit) {
+                if (carry == 0 || n == 0) {
+                    return carry;
                 }
-                this->digits = temp;
-                this->exponent = integral_length;
+                if (r[n - 1] > max_digit - carry) {
+                    r[n - 1] -= max_digit - carry + 1;
+                    return propagate_carry(r, n - 1, 1, max_digit);
+                }
+                r[n - 1] += carry;
+                return 0;
+            }
+
+            /// subtracts the digit borrow from r[n - 1] and borrows on up, returns the borrow out of r[0]
+            static T subtract_digit_in_place(T* r, size_t n, T borrow, T max_digit) {
+                if (borrow == 0 || n == 0) {
+                    return borrow;
+                }
+                if (r[n - 1] < borrow) {
+                    r[n - 1] += max_digit - borrow + 1;
+                    return propagate_borrow(r, n - 1, 1, max_digit);
+                }
+                r[n - 1] -= borrow;
+                return 0;
+            }
+
+            /**
+             *  @brief: divides the digit span r[0..n) by a small divisor in place, walking from the highest
+             *          to the lowest digit. Every step splits rem * base + r[i] as
+             *          rem * divisor * (base / divisor) + rem * (base % divisor) + r[i], so no partial value
+             *          exceeds divisor^2 + base and the kernel needs no wide type.
+             *  @param: r: first digit of the number, most significant digit first
+             *  @param: n: number of digits
+             *  @param: divisor: the divisor, divisor^2 + base must fit in T
+             *  @param: base: base of the digits
+             *  @return: the remainder of the division
+             */
+            static T divide_by_small_in_place(T* r, size_t n, T divisor, T base) {
+                const T base_quotient = base / divisor;
+                const T base_remainder = base % divisor;
+                T rem = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    T low = rem * base_remainder + r[i];
+                    r[i] = rem * base_quotient + low / divisor;
+                    rem = low % divisor;
+                }
+                return rem;
+            }
+
+            /**
+             *  @brief: shifts the digit span r[0..n) of a binary base left by bits bits in place. The bits
+             *          leaving a digit move into the digit before it, the ones leaving r[0] are returned.
+             *  @param: r: first digit of the number, most significant digit first
+             *  @param: n: number of digits
+             *  @param: bits: the shift, 0 <= bits < limb_traits<T>::base_bits
+             *  @return: the bits shifted out of r[0], a value below 2^bits
+             */
+            static T shift_left_in_place(T* r, size_t n, int bits) {
+                using U = typename std::make_unsigned<T>::type;
+                const int limb_bits = limb_traits<T>::base_bits;
+                const U mask = (U) limb_traits<T>::max_digit;
+                U carry = 0;
+                for (size_t i = n; i-- > 0;) {
+                    const U digit = (U) r[i];
+                    r[i] = (T) (((digit << bits) & mask) | carry);
+                    carry = digit >> (limb_bits - bits);
+                }
+                return (T) carry;
+            }
+
+            /**
+             *  @brief: shifts the digit span r[0..n) of a binary base right by bits bits in place, the
+             *          counterpart of shift_left_in_place.
+             *  @return: the bits shifted out of r[n - 1], a value below 2^bits
+             */
+            static T shift_right_in_place(T* r, size_t n, int bits) {
+                using U = typename std::make_unsigned<T>::type;
+                const int limb_bits = limb_traits<T>::base_bits;
+                const U low_mask = ((U) 1 << bits) - 1;
+                U rem = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    const U digit = (U) r[i];
+                    r[i] = (T) ((digit >> bits) | (rem << (limb_bits - bits)));
+                    rem = digit & low_mask;
+                }
+                return (T) rem;
+            }
+
+            /**
+             *  @brief: halves the integer digits in place, rounding down, and drops the leading zero the
+             *          halving can leave. A binary base shifts, other bases divide by 2.
+             *  @return: the parity of the integer before halving
+             */
+            static bool halve_integer(std::vector<T> &digits) {
+                T rem;
+                if constexpr (limb_traits<T>::binary_base) {
+                    rem = shift_right_in_place(digits.data(), digits.size(), 1);
+                } else {
+                    rem = divide_by_small_in_place(digits.data(), digits.size(), 2, limb_traits<T>::base);
+                }
+                if (digits.size() > 1 && digits.front() == 0) {
+                    digits.erase(digits.begin());
+                }
+                return rem != 0;
+            }
+
+            /// adds other to *this. disregards sign -- that's taken care of in the operators.
+            void add_vector(const exact_number &other, T base = limb_traits<T>::max_digit){
+                // aligned fast path: both numbers cover the same digit positions, so we add in place
+                if (this->exponent == other.exponent && this->digits.size() == other.digits.size()) {
+                    if (add_in_place(this->digits.data(), other.digits.data(), this->digits.size(), base)) {
+                        this->push_front(1);
+                        this->exponent++;
+                    }
+                    this->normalize();
+                    return;
+                }
+
+                int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
+                int integral_length = std::max(this->exponent, other.exponent);
+                int length = fractional_length + integral_length;
+
+                if (length <= 0) {
+                    this->digits.clear();
+                    this->exponent = integral_length;
+                    return;
+                }
+
+                // temp[0] is reserved for the carry out of the highest digit, the remaining digits
+                // hold both operands aligned on their exponents
+                digits_type temp(length + 1, 0);
+                const int lhs_offset = 1 + integral_length - this->exponent;
+                const int rhs_offset = 1 + integral_length - other.exponent;
+                std::copy(this->digits.cbegin(), this->digits.cend(), temp.begin() + lhs_offset);
+
+                T carry = add_in_place(temp.data() + rhs_offset, other.digits.data(), other.digits.size(), base);
+                propagate_carry(temp.data(), rhs_offset, carry, base);
+
+                this->digits.swap(temp);
+                this->exponent = integral_length + 1;
                 this->normalize();
             }
 
             /// subtracts other from *this, disregards sign -- that's taken care of in the operators
-            void subtract_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
-                std::vector<T> result;
+            void subtract_vector(const exact_number &other, T base = limb_traits<T>::max_digit) {
+                // aligned fast path: both numbers cover the same digit positions, so we subtract in place
+                if (this->exponent == other.exponent && this->digits.size() == other.digits.size()) {
+                    subtract_in_place(this->digits.data(), other.digits.data(), this->digits.size(), base);
+                    this->normalize();
+                    return;
+                }
+
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
                 int integral_length = std::max(this->exponent, other.exponent);
-                int borrow = 0;
-                // we walk the numbers from the lowest to the highest digit
-                for (int i = fractional_length - 1; i >= -integral_length; i--) {
+                int length = fractional_length + integral_length;
 
-                    T digit = 0;
+                if (length <= 0) {
+                    this->digits.clear();
+                    this->exponent = integral_length;
+                    return;
+                }
 
-                    T lhs_digit = 0;
-                    if (0 <= this->exponent + i && this->exponent + i < (int)this->digits.size()) {
-                        lhs_digit = this->digits[this->exponent + i];
-                    }
+                digits_type result(length, 0);
+                const int lhs_offset = integral_length - this->exponent;
+                const int rhs_offset = integral_length - other.exponent;
+                std::copy(this->digits.cbegin(), this->digits.cend(), result.begin() + lhs_offset);
 
-                    T rhs_digit = 0;
-                    if (0 <= other.exponent + i && other.exponent + i < (int) other.digits.size()) {
-                        rhs_digit = other.digits[other.exponent + i];
-                    }
+                T borrow = subtract_in_place(result.data() + rhs_offset, other.digits.data(), other.digits.size(), base);
+                propagate_borrow(result.data(), rhs_offset, borrow, base);
 
-                    if (lhs_digit < borrow) {
-                        digit = (base - rhs_digit) + 1 - borrow;
-                    } else {
-                        lhs_digit -= borrow;
-                        borrow = 0;
-                        
-                        if (lhs_digit < rhs_digit) {
-                        ++borrow;
-                        digit = (base - (rhs_digit -1)) + lhs_digit;
-                        } else {
-                            digit = lhs_digit - rhs_digit;
-                        }
+                this->digits.swap(result);
+                this->exponent = integral_length;
+                this->normalize();
+            }
+
+            /// adds other to *this (or subtracts it, if subtract_other is set) taking the signs of both into account
+            void signed_add_vector(const exact_number &other, bool subtract_other, T base = limb_traits<T>::max_digit) {
+                const bool other_positive = (other.positive != subtract_other);
+                if (this->positive == other_positive) {
+                    this->add_vector(other, base);
+                } else if (abs_is_lower(*this, other)) {
+                    exact_number<T> result = other;
+                    result.subtract_vector(*this, base);
+                    result.positive = other_positive;
+                    *this = std::move(result);
+                } else {
+                    this->subtract_vector(other, base);
+                }
+            }
+
+            /**
+             *  @brief: widens the digits of *this in place to cover a span of n digits with the given
+             *          exponent, and one more digit in front of both that takes the carry of a sum. The
+             *          digits added in front reuse the room left by trimmed leading zeros.
+             *  @return: the index of the first digit of the span in the digits of *this
+             */
+            size_t widen_to(int exponent, size_t n) {
+                const int top = std::max(this->exponent, exponent) + 1;
+                const long long low = std::min((long long) this->exponent - (long long) this->digits.size(),
+                                               (long long) exponent - (long long) n);
+                this->digits.insert(this->digits.cbegin(), (size_t) (top - this->exponent), 0);
+                this->digits.resize((size_t) (top - low), 0);
+                this->exponent = top;
+                return (size_t) (top - exponent);
+            }
 
-                    }                    
-                    result.insert(result.begin(), digit);
+            /**
+             *  @brief: finishes a sum made on the widened digits of *this. A subtraction that borrowed out of
+             *          the first digit went below zero and left base^size - |result|, which is negated here.
+             */
+            void finish_in_place_sum(bool borrowed_out) {
+                if (borrowed_out) {
+                    const T max_digit = limb_traits<T>::max_digit;
+                    for (auto &digit : this->digits) {
+                        digit = max_digit - digit;
+                    }
+                    propagate_carry(this->digits.data(), this->digits.size(), 1, max_digit);
+                    this->positive = !this->positive;
                 }
-                this->digits = result;
-                this->exponent = integral_length;
                 this->normalize();
             }
 
             //Returns (a*b)%mod
             static T mul_mod(T a, T b, T mod) 
             { 
-                T res = 0; // Initialize result 
-                a = a % mod; 
-                while (b > 0) 
-                { 
-                    // If b is odd, add 'a' to result 
-                    if (b % 2 == 1) 
-                        res = (res + a) % mod; 
-            
-                    // Multiply 'a' with 2 
-                    a = (a * 2) % mod; 
-            
-                    // Divide b by 2 
-                    b /= 2; 
-                } 
-            
-                return res % mod; 
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    return (T) (((wide_type) a * (wide_type) b) % (wide_type) mod);
+                } else {
+                    T res = 0; // Initialize result 
+                    a = a % mod; 
+                    while (b > 0) 
+                    { 
+                        // If b is odd, add 'a' to result 
+                        if (b % 2 == 1) 
+                            res = (res + a) % mod; 
+                
+                        // Multiply 'a' with 2 
+                        a = (a * 2) % mod; 
+                
+                        // Divide b by 2 
+                        b /= 2; 
+                    } 
+                
+                    return res % mod; 
+                }
             }
 
             //Returns (a*b)/mod
             static T mult_div(T a, T b, T c) {
-                T rem = 0;
-                T res = (a / c) * b;
-                a = a % c;
-                // invariant: a_orig * b_orig = (res * c + rem) + a * b
-                // a < c, rem < c.
-                while (b != 0) {
-                    if (b & 1) {
-                        rem += a;
-                        if (rem >= c) {
-                            rem -= c;
-                            res++;
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    return (T) (((wide_type) a * (wide_type) b) / (wide_type) c);
+                } else {
+                    T rem = 0;
+                    T res = (a / c) * b;
+                    a = a % c;
+                    // invariant: a_orig * b_orig = (res * c + rem) + a * b
+                    // a < c, rem < c.
+                    while (b != 0) {
+                        if (b & 1) {
+                            rem += a;
+                            if (rem >= c) {
+                                rem -= c;
+                                res++;
+                            }
+                        }
+                        b /= 2;
+                        a *= 2;
+                        if (a >= c) {
+                            a -= c;
+                            res += b;
                         }
                     }
-                    b /= 2;
-                    a *= 2;
-                    if (a >= c) {
-                        a -= c;
-                        res += b;
-                    }
+                    return res;
                 }
-                return res;
             } 
 
-            /// multiplies *this by other
-            void multiply_vector(exact_number &other, T base = (std::numeric_limits<T>::max() / 4) * 2) {
-                karatsuba_multiplication(other, base);
+            /// multiplies *this by other, picking the algorithm from the size of the larger operand
+            void multiply_vector(const exact_number &other, T base = limb_traits<T>::base) {
+                std::vector<T> scratch;
+                multiply_vector(other, scratch, base);
             }
 
-            /// multiplies *this by other
-            void standard_multiplication(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2) {
-                // will keep the result number in vector in reverse order
-                // Digits: .123 | Exponent: -3 | .000123 <--- Number size is the Digits size less the exponent
-                // Digits: .123 | Exponent: 2  | 12.3
-                std::vector<T> temp;
-                size_t new_size = this->digits.size() + other.digits.size();
-                if (this->exponent < 0) new_size -= this->exponent; // <--- Less the exponent
-                if (other.exponent < 0) new_size -= other.exponent; // <--- Less the exponent
-
-                temp.assign(new_size, 0);
-
-                // Below two indexes are used to find positions
-                // in result.
-                auto i_n1 = (int) temp.size() - 1;
-                // Go from right to left in lhs
-                for (int i = (int)this->digits.size()-1; i >= 0; i--) {
-                    T carry = 0;
-
-                    // To shift position to left after every
-                    // multiplication of a digit in rhs
-                    int i_n2 = 0;
-
-                    // Go from right to left in rhs
-                    for (int j = (int)other.digits.size()-1; j>=0; j--) {
-
-                        // Multiply current digit of second number with current digit of first number
-                        // and add result to previously stored result at current position.
-                        T rem = mul_mod(this->digits[i], other.digits[j], base);
-                        T rem_s;
-                        T q = mult_div(this->digits[i], other.digits[j], base);
-                        if ( temp[i_n1 - i_n2] >= base - carry ) {
-                            rem_s = carry - (base - temp[i_n1 - i_n2]);
-                            ++q;
+            /// the algorithms of multiply_vector and square, from the shortest operands to the longest
+            enum class multiplication_algorithm { karatsuba, toom_3, toom_4, ntt };
+
+            /**
+             *  @brief: the algorithm multiply_vector uses for operands of max_length and min_length digits.
+             *          A product of operands of very different lengths is priced by the shorter one, it either
+             *          goes through a single NTT or through chunks of the shorter length. The others climb
+             *          the tiers with the longer operand, toom_3 < toom_4 < ntt in threshold_set.
+             *  @param: ntt_available: whether the NTT primes are enough for the product, see ntt_primes_needed
+             */
+            static multiplication_algorithm select_multiplication(size_t max_length, size_t min_length, bool ntt_available) {
+                const threshold_set &thresholds = algorithm_thresholds<T>::get();
+                if (max_length - min_length > min_length) {
+                    if (min_length >= (size_t) thresholds.ntt_unbalanced && ntt_available) {
+                        return multiplication_algorithm::ntt;
+                    }
+                    return multiplication_algorithm::karatsuba;
+                }
+
+                if (max_length >= (size_t) thresholds.ntt && ntt_available) {
+                    return multiplication_algorithm::ntt;
+                } else if (max_length >= (size_t) thresholds.toom_4) {
+                    return multiplication_algorithm::toom_4;
+                } else if (max_length >= (size_t) thresholds.toom_3) {
+                    return multiplication_algorithm::toom_3;
+                }
+                return multiplication_algorithm::karatsuba;
+            }
+
+            /// multiplies *this by other, reusing scratch as the work space of karatsuba_multiplication
+            void multiply_vector(const exact_number &other, std::vector<T> &scratch, T base = limb_traits<T>::base) {
+                if (this == &other) {
+                    this->square(scratch, base);
+                    return;
+                }
+
+                const size_t max_length = std::max(this->digits.size(), other.digits.size());
+                const size_t min_length = std::min(this->digits.size(), other.digits.size());
+                // the prime count is only worked out for operands long enough for the transform
+                const threshold_set &thresholds = algorithm_thresholds<T>::get();
+                const bool ntt_candidate = max_length >= (size_t) std::min(thresholds.ntt, thresholds.ntt_unbalanced);
+
+                switch (select_multiplication(max_length, min_length, ntt_candidate && ntt_primes_needed(other, base) > 0)) {
+                    case multiplication_algorithm::ntt:
+                        ntt_multiplication(other, base);
+                        break;
+                    case multiplication_algorithm::toom_4:
+                        toom_cook_multiplication(other, 4, base);
+                        break;
+                    case multiplication_algorithm::toom_3:
+                        toom_cook_multiplication(other, 3, base);
+                        break;
+                    default:
+                        karatsuba_multiplication(other, scratch, base);
+                }
+            }
+
+            /// squares *this, picking the algorithm from its size like multiply_vector does for products
+            void square(T base = limb_traits<T>::base) {
+                std::vector<T> scratch;
+                square(scratch, base);
+            }
+
+            /// squares *this, reusing scratch as the work space of karatsuba_square
+            void square(std::vector<T> &scratch, T base = limb_traits<T>::base) {
+                const size_t length = this->digits.size();
+                const bool ntt_candidate = length >= (size_t) algorithm_thresholds<T>::get().ntt;
+
+                switch (select_multiplication(length, length, ntt_candidate && ntt_primes_needed(*this, base) > 0)) {
+                    case multiplication_algorithm::ntt:
+                        ntt_multiplication(*this, base);
+                        break;
+                    case multiplication_algorithm::toom_4:
+                        toom_cook_multiplication(*this, 4, base);
+                        break;
+                    case multiplication_algorithm::toom_3:
+                        toom_cook_multiplication(*this, 3, base);
+                        break;
+                    default:
+                        karatsuba_square(scratch, base);
+                }
+            }
+
+            /**
+             *  @brief: schoolbook product of two digit spans, r[0..na + nb) = a[0..na) * b[0..nb), all of them
+             *          most significant digit first. r must not overlap a or b.
+             *  @param: base: base of the digits
+             */
+            static void multiply_basecase(T* r, const T* a, size_t na, const T* b, size_t nb, T base) {
+                if (detail::simd_multiply_basecase(r, a, na, b, nb, base)) {
+                    return;
+                }
+
+                std::fill(r, r + na + nb, 0);
+
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    // a limb product plus two limbs is lower than base^2, so it fits the wide type and every
+                    // result digit costs one multiplication and one division
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    const wide_type wide_base = base;
+
+                    for (size_t i = na; i-- > 0;) {
+                        const wide_type lhs_digit = a[i];
+                        wide_type carry = 0;
+                        // row i ends at r[i + nb], and its carry lands on r[i], which no earlier row has written
+                        T* row = r + i + 1;
+
+                        for (size_t j = nb; j-- > 0;) {
+                            wide_type t = lhs_digit * (wide_type) b[j] + (wide_type) row[j] + carry;
+                            row[j] = (T) (t % wide_base);
+                            carry = t / wide_base;
                         }
-                        else
-                            rem_s = temp[i_n1 - i_n2] + carry;
-                        if ( rem >= base - rem_s ) {
-                            rem -= (base - rem_s);
-                            ++q;
+                        r[i] = (T) carry;
+                    }
+                } else {
+                    for (size_t i = na; i-- > 0;) {
+                        T carry = 0;
+                        T* row = r + i + 1;
+
+                        for (size_t j = nb; j-- > 0;) {
+                            // Multiply current digit of second number with current digit of first number
+                            // and add result to previously stored result at current position.
+                            T rem = mul_mod(a[i], b[j], base);
+                            T rem_s;
+                            T q = mult_div(a[i], b[j], base);
+                            if ( row[j] >= base - carry ) {
+                                rem_s = carry - (base - row[j]);
+                                ++q;
+                            }
+                            else
+                                rem_s = row[j] + carry;
+                            if ( rem >= base - rem_s ) {
+                                rem -= (base - rem_s);
+                                ++q;
+                            }
+                            else
+                                rem += rem_s;
+
+                            // Carry for next iteration
+                            carry = q;
+
+                            // Store result
+                            row[j] = rem;
                         }
-                        else
-                            rem += rem_s;
+                        r[i] = carry;
+                    }
+                }
+            }
 
-                        // Carry for next iteration
-                        carry = q;
+            /**
+             *  @brief: short product, the top k + 1 digits of a[0..na) * b[0..nb), most significant digit first.
+             *          Only the limb products a[i] * b[j] with i + j < k are summed into r[0..k], the dropped
+             *          ones add up to less than 2 * min(na, nb) units of r[k - 1], so r is a lower bound of
+             *          the product's top digits and at most that far below them. r must not overlap a or b.
+             *  @param: base: base of the digits
+             */
+            static void multiply_high_basecase(T* r, const T* a, size_t na, const T* b, size_t nb, size_t k, T base) {
+                na = std::min(na, k);
+                nb = std::min(nb, k);
+                if (na + nb <= k + 1) {
+                    // every limb product is kept, this is the full product
+                    std::fill(r, r + k + 1, 0);
+                    multiply_basecase(r, a, na, b, nb, base);
+                    return;
+                }
+
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    const wide_type wide_base = base;
+                    std::fill(r, r + k + 1, 0);
 
-                        // Store result
-                        temp[i_n1 - i_n2] = rem;
+                    // as in multiply_basecase, but row i stops at b[k - i - 1], it ends at r[k] at the latest
+                    for (size_t i = na; i-- > 0;) {
+                        const wide_type lhs_digit = a[i];
+                        wide_type carry = 0;
+                        T* row = r + i + 1;
 
-                        i_n2++;
+                        for (size_t j = std::min(nb, k - i); j-- > 0;) {
+                            wide_type t = lhs_digit * (wide_type) b[j] + (wide_type) row[j] + carry;
+                            row[j] = (T) (t % wide_base);
+                            carry = t / wide_base;
+                        }
+                        r[i] = (T) carry;
                     }
+                } else {
+                    // the full product of the top k limbs of each operand, its first k + 1 digits are at
+                    // least the sum above and the dropped tail is within the same bound
+                    std::vector<T> product(na + nb);
+                    multiply_basecase(product.data(), a, na, b, nb, base);
+                    std::copy(product.begin(), product.begin() + k + 1, r);
+                }
+            }
 
-                    // store carry in next cell
-                    if (carry > 0) {
-                        temp[i_n1 - i_n2] += carry;
+            /**
+             *  @brief: schoolbook square of a digit span, r[0..2n) = a[0..n)^2, most significant digit first.
+             *          r must not overlap a. Every cross product a[i] * a[j], i < j, is computed once, the
+             *          sum of them is doubled and the squares a[i]^2 are added in the same carry pass,
+             *          which saves almost half of the limb products of multiply_basecase.
+             *  @param: base: base of the digits
+             */
+            static void square_basecase(T* r, const T* a, size_t n, T base) {
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    const wide_type wide_base = base;
+                    std::fill(r, r + 2 * n, 0);
+
+                    // a[i] * a[j] lands on r[i + j + 1], row i ends with its carry on r[2i + 1], which
+                    // no earlier row has written
+                    for (size_t i = n - 1; i-- > 0;) {
+                        const wide_type lhs_digit = a[i];
+                        wide_type carry = 0;
+                        for (size_t j = n; j-- > i + 1;) {
+                            wide_type t = lhs_digit * (wide_type) a[j] + (wide_type) r[i + j + 1] + carry;
+                            r[i + j + 1] = (T) (t % wide_base);
+                            carry = t / wide_base;
+                        }
+                        r[2 * i + 1] = (T) carry;
                     }
 
-                    // To shift position to left after every
-                    // multiplication of a digit in lhs.
-                    i_n1--;
+                    // r = 2 * r + sum of a[i]^2 * base^(2(n - 1 - i)), the square of a[i] covering r[2i..2i + 1].
+                    // 2 * r[k] + a square digit + carry stays below 4 * base, far from the limits of wide_type
+                    wide_type carry = 0;
+                    for (size_t i = n; i-- > 0;) {
+                        const wide_type digit_square = (wide_type) a[i] * (wide_type) a[i];
+
+                        wide_type t = 2 * (wide_type) r[2 * i + 1] + digit_square % wide_base + carry;
+                        r[2 * i + 1] = (T) (t % wide_base);
+                        carry = t / wide_base;
+
+                        t = 2 * (wide_type) r[2 * i] + digit_square / wide_base + carry;
+                        r[2 * i] = (T) (t % wide_base);
+                        carry = t / wide_base;
+                    }
+                } else {
+                    multiply_basecase(r, a, n, a, n, base);
                 }
+            }
 
-                int fractional_part = ((int)this->digits.size() - this->exponent) + ((int)other.digits.size() - other.exponent);
-                int result_exponent = (int)temp.size() - fractional_part;
-                
-                digits = temp;
-                exponent = result_exponent;
+            /// multiplies *this by other
+            void standard_multiplication(const exact_number &other, T base = limb_traits<T>::base) {
+                // the product of the digit vectors as integers has a_size + b_size digits and
+                // a_exponent + b_exponent of them in front of the point
+                // Digits: .123 | Exponent: -3 | .000123 <--- Number size is the Digits size less the exponent
+                // Digits: .123 | Exponent: 2  | 12.3
+                digits_type temp(this->digits.size() + other.digits.size());
+                multiply_basecase(temp.data(), this->digits.data(), this->digits.size(), other.digits.data(), other.digits.size(), base);
+
+                this->digits.swap(temp);
+                this->exponent += other.exponent;
                 this->positive = this->positive == other.positive;
+                if (this->digits.empty()) {
+                    this->digits = {0};
+                }
                 this->normalize();
             }
 
+            /// compares the digit spans x[0..nx) and y[0..ny) as integers, returns -1, 0 or 1
+            static int compare_spans(const T* x, size_t nx, const T* y, size_t ny) {
+                for (; nx > ny; --nx, ++x) {
+                    if (*x != 0) return 1;
+                }
+                for (; ny > nx; --ny, ++y) {
+                    if (*y != 0) return -1;
+                }
+                size_t i = 0;
+                detail::simd_mismatch(x, y, nx, i);
+                for (; i < nx; ++i) {
+                    if (x[i] != y[i]) return (x[i] < y[i]) ? -1 : 1;
+                }
+                return 0;
+            }
+
+            /**
+             *  @brief: d[0..h) = |hi[0..h) - lo[0..m)| for m <= h
+             *  @return: true if hi < lo
+             */
+            static bool absolute_difference(T* d, const T* hi, const T* lo, size_t h, size_t m, T max_digit) {
+                if (compare_spans(hi, h, lo, m) >= 0) {
+                    std::copy(hi, hi + h, d);
+                    T borrow = subtract_in_place(d + h - m, lo, m, max_digit);
+                    propagate_borrow(d, h - m, borrow, max_digit);
+                    return false;
+                }
+                // hi < lo, so the h - m leading digits of hi are zeros
+                std::fill(d, d + h - m, 0);
+                std::copy(lo, lo + m, d + h - m);
+                subtract_in_place(d + h - m, hi + h - m, m, max_digit);
+                return true;
+            }
+
+            /// number of scratch digits karatsuba_multiplication needs for operands of up to n digits
+            static size_t karatsuba_scratch_size(size_t n, size_t base_case_threshold = algorithm_thresholds<T>::get().karatsuba_base_case) {
+                // a zero padded copy of the shorter operand, then the buffers of every recursion level
+                size_t size = n;
+                while (n > base_case_threshold && n >= 2) {
+                    const size_t h = n - n / 2;
+                    size += 6 * h + 1;
+                    n = h;
+                }
+                return size;
+            }
+
+            /**
+             *  @brief: KARATSUBA KERNEL: r[0..2n) = a[0..n) * b[0..n) on digit spans, most significant digit
+             *          first. With m = n / 2 low and h = n - m high digits, a = a_hi * base^m + a_lo and
+             *          b = b_hi * base^m + b_lo:
+             *
+             *              a * b = z2 * base^2m + (z2 + z0 - (a_hi - a_lo) * (b_hi - b_lo)) * base^m + z0
+             *
+             *          where z2 = a_hi * b_hi and z0 = a_lo * b_lo are computed right into their place in r.
+             *          The differences keep every intermediate non negative and of h digits. All buffers are
+             *          carved from scratch, which must hold karatsuba_scratch_size(n) - n digits.
+             */
+            static void karatsuba_kernel(T* r, const T* a, const T* b, size_t n, T* scratch, T base) {
+                if (n <= (size_t) algorithm_thresholds<T>::get().karatsuba_base_case || n < 2) {
+                    multiply_basecase(r, a, n, b, n, base);
+                    return;
+                }
+
+                const T max_digit = base - 1;
+                const size_t m = n / 2;
+                const size_t h = n - m;
+
+                T* a_difference = scratch;
+                T* b_difference = a_difference + h;
+                T* z1 = b_difference + h;
+                T* middle = z1 + 2 * h;
+                T* next_scratch = middle + 2 * h + 1;
+
+                karatsuba_kernel(r, a, b, h, next_scratch, base);
+                karatsuba_kernel(r + 2 * h, a + h, b + h, m, next_scratch, base);
+
+                const bool a_negative = absolute_difference(a_difference, a, a + h, h, m, max_digit);
+                const bool b_negative = absolute_difference(b_difference, b, b + h, h, m, max_digit);
+                karatsuba_kernel(z1, a_difference, b_difference, h, next_scratch, base);
+
+                // middle = z2 + z0 -+ z1 = a_hi * b_lo + a_lo * b_hi, lower than 2 * base^2h
+                middle[0] = 0;
+                std::copy(r, r + 2 * h, middle + 1);
+                T carry = add_in_place(middle + 1 + 2 * (h - m), r + 2 * h, 2 * m, max_digit);
+                propagate_carry(middle, 1 + 2 * (h - m), carry, max_digit);
+                if (a_negative == b_negative) {
+                    T borrow = subtract_in_place(middle + 1, z1, 2 * h, max_digit);
+                    propagate_borrow(middle, 1, borrow, max_digit);
+                } else {
+                    carry = add_in_place(middle + 1, z1, 2 * h, max_digit);
+                    propagate_carry(middle, 1, carry, max_digit);
+                }
+
+                // the lowest digit of middle goes m digits above the lowest digit of r
+                carry = add_in_place(r + m - 1, middle, 2 * h + 1, max_digit);
+                propagate_carry(r, m - 1, carry, max_digit);
+            }
+
             /**
-             *  @brief: KARATSUBA MULTIPLICATION: multiplies (*this) with other using karatsuba multiplication algorithm
+             *  @brief: KARATSUBA SQUARING KERNEL: r[0..2n) = a[0..n)^2, the karatsuba_kernel of a with itself.
+             *          The middle term is z2 + z0 - (a_hi - a_lo)^2, so only one difference is formed and
+             *          every recursive product is a square again. square_basecase saves enough products to stay
+             *          ahead up to threshold_set::karatsuba_square digits, which sizes the scratch instead.
+             */
+            static void karatsuba_square_kernel(T* r, const T* a, size_t n, T* scratch, T base) {
+                if (n <= (size_t) algorithm_thresholds<T>::get().karatsuba_square || n < 2) {
+                    square_basecase(r, a, n, base);
+                    return;
+                }
+
+                const T max_digit = base - 1;
+                const size_t m = n / 2;
+                const size_t h = n - m;
+
+                T* difference = scratch;
+                T* z1 = difference + h;
+                T* middle = z1 + 2 * h;
+                T* next_scratch = middle + 2 * h + 1;
+
+                karatsuba_square_kernel(r, a, h, next_scratch, base);
+                karatsuba_square_kernel(r + 2 * h, a + h, m, next_scratch, base);
+
+                absolute_difference(difference, a, a + h, h, m, max_digit);
+                karatsuba_square_kernel(z1, difference, h, next_scratch, base);
+
+                // middle = z2 + z0 - z1 = 2 * a_hi * a_lo, lower than 2 * base^2h
+                middle[0] = 0;
+                std::copy(r, r + 2 * h, middle + 1);
+                T carry = add_in_place(middle + 1 + 2 * (h - m), r + 2 * h, 2 * m, max_digit);
+                propagate_carry(middle, 1 + 2 * (h - m), carry, max_digit);
+                T borrow = subtract_in_place(middle + 1, z1, 2 * h, max_digit);
+                propagate_borrow(middle, 1, borrow, max_digit);
+
+                carry = add_in_place(r + m - 1, middle, 2 * h + 1, max_digit);
+                propagate_carry(r, m - 1, carry, max_digit);
+            }
+
+            /**
+             *  @brief: UNBALANCED MULTIPLICATION: r[0..na + nb) = a[0..na) * b[0..nb) for na >= nb, on digit
+             *          spans. a is cut into chunks of nb digits from its least significant end, every chunk is
+             *          multiplied by b as a balanced product and added into its place in r. The cost is
+             *          na / nb balanced products of nb digits instead of a schoolbook product of na * nb.
+             *          scratch must hold karatsuba_scratch_size(nb) - nb digits; chunks of threshold_set::toom_3
+             *          digits or more go through multiply_spans instead.
+             */
+            static void multiply_unbalanced(T* r, const T* a, size_t na, const T* b, size_t nb, T* scratch, T base) {
+                const T max_digit = base - 1;
+                std::vector<T> product(2 * nb);
+
+                std::fill(r, r + na + nb, 0);
+                for (size_t end = na; end > 0;) {
+                    const size_t length = std::min(nb, end);
+                    const size_t begin = end - length;
+
+                    if (length == nb && nb < (size_t) algorithm_thresholds<T>::get().toom_3) {
+                        karatsuba_kernel(product.data(), a + begin, b, nb, scratch, base);
+                    } else {
+                        // the shortest, most significant chunk is unbalanced again and recurses through multiply_vector
+                        multiply_spans(product.data(), a + begin, length, b, nb, base);
+                    }
+
+                    // the product of a[begin..end) is shifted by the na - end digits below the chunk
+                    T carry = add_in_place(r + begin, product.data(), length + nb, max_digit);
+                    propagate_carry(r, begin, carry, max_digit);
+                    end = begin;
+                }
+            }
+
+            /**
+             *  @brief: KARATSUBA MULTIPLICATION: multiplies (*this) with other using karatsuba multiplication algorithm.
+             *          An operand more than twice as long as the other goes through multiply_unbalanced, or through
+             *          standard_multiplication if the other is shorter than threshold_set::karatsuba_unbalanced.
              *  @param: other: an exact_number to be multiplied with (*this)
+             *  @param: scratch: work space of the recursion, grown to karatsuba_scratch_size if it is smaller.
+             *          Passing the same vector to consecutive products avoids any allocation but the result's.
              *  @param: base: base of the numbers being multiplied
              *  @author: Kishan Shukla
              */
-
             void karatsuba_multiplication (
-                    exact_number<T> &other, 
-                    const T base = (std::numeric_limits<T>::max() / 4) * 2
+                    const exact_number<T> &other,
+                    std::vector<T> &scratch,
+                    const T base = limb_traits<T>::base
             ) {
+                if (this == &other) {
+                    this->karatsuba_square(scratch, base);
+                    return;
+                }
+
+                const size_t a_size = this->digits.size();
+                const size_t b_size = other.digits.size();
+                const size_t max_length = std::max(a_size, b_size);
+                const size_t min_length = std::min(a_size, b_size);
+
+                const bool unbalanced = max_length - min_length > min_length;
+                if (min_length <= (size_t) algorithm_thresholds<T>::get().karatsuba_base_case ||
+                    (unbalanced && min_length < (size_t) algorithm_thresholds<T>::get().karatsuba_unbalanced)) {
+                    this->standard_multiplication(other, base);
+                    return;
+                }
 
-                // this --- a, other --- b
+                if (unbalanced) {
+                    const size_t scratch_size = karatsuba_scratch_size(min_length);
+                    if (scratch.size() < scratch_size) {
+                        scratch.resize(scratch_size);
+                    }
+
+                    const exact_number<T> &longer = (a_size >= b_size) ? *this : other;
+                    const exact_number<T> &shorter = (a_size >= b_size) ? other : *this;
+                    digits_type result(a_size + b_size);
+                    multiply_unbalanced(result.data(), longer.digits.data(), max_length, shorter.digits.data(), min_length, scratch.data(), base);
+
+                    this->digits.swap(result);
+                    this->exponent += other.exponent;
+                    this->positive = (this->positive == other.positive);
+                    this->normalize();
+                    return;
+                }
+
+                const size_t scratch_size = karatsuba_scratch_size(max_length);
+                if (scratch.size() < scratch_size) {
+                    scratch.resize(scratch_size);
+                }
+
+                // appending zeroes in front of the shorter number to make sizes of a & b equal
+                const T* a = this->digits.data();
+                const T* b = other.digits.data();
+                T* padded = scratch.data();
+                if (a_size < max_length) {
+                    std::fill(padded, padded + max_length - a_size, 0);
+                    std::copy(this->digits.begin(), this->digits.end(), padded + max_length - a_size);
+                    a = padded;
+                } else if (b_size < max_length) {
+                    std::fill(padded, padded + max_length - b_size, 0);
+                    std::copy(other.digits.begin(), other.digits.end(), padded + max_length - b_size);
+                    b = padded;
+                }
+
+                digits_type result(2 * max_length);
+                karatsuba_kernel(result.data(), a, b, max_length, scratch.data() + max_length, base);
+
+                // the padded product has 2 * max_length - (a_size + b_size) more integer digits
+                this->digits.swap(result);
+                this->exponent += other.exponent + (int)(2 * max_length - a_size - b_size);
+                this->positive = (this->positive == other.positive);
+                this->normalize();
+            }
+
+            /// multiplies (*this) with other using karatsuba multiplication algorithm
+            void karatsuba_multiplication(const exact_number<T> &other, const T base = limb_traits<T>::base) {
+                std::vector<T> scratch;
+                this->karatsuba_multiplication(other, scratch, base);
+            }
+
+            /**
+             *  @brief: KARATSUBA SQUARING: squares (*this) with karatsuba_square_kernel, or square_basecase
+             *          up to threshold_set::karatsuba_square digits
+             *  @param: scratch: work space of the recursion, grown to karatsuba_scratch_size if it is smaller
+             *  @param: base: base of the number being squared
+             */
+            void karatsuba_square(std::vector<T> &scratch, const T base = limb_traits<T>::base) {
+                const size_t length = this->digits.size();
+                if (length == 0) {
+                    this->digits = {0};
+                    this->exponent = 0;
+                    this->positive = true;
+                    return;
+                }
+
+                const size_t scratch_size = karatsuba_scratch_size(length, algorithm_thresholds<T>::get().karatsuba_square);
+                if (scratch.size() < scratch_size) {
+                    scratch.resize(scratch_size);
+                }
+
+                digits_type result(2 * length);
+                karatsuba_square_kernel(result.data(), this->digits.data(), length, scratch.data(), base);
+
+                this->digits.swap(result);
+                this->exponent *= 2;
+                this->positive = true;
+                this->normalize();
+            }
+
+            /// multiplies the integer *this by a single digit factor
+            void multiply_by_small(T factor, T base = limb_traits<T>::base) {
+                T carry = multiply_by_small_in_place(this->digits.data(), this->digits.size(), factor, base);
+                if (carry != 0) {
+                    this->push_front(carry);
+                    this->exponent++;
+                }
+                this->normalize();
+            }
+
+            /// divides the integer *this by a small divisor that is known to divide it exactly
+            void exact_divide_by_small(T divisor, T base = limb_traits<T>::base) {
+                // trailing zeros of the integer part take part in the division
+                while (this->exponent > (int)this->digits.size()) {
+                    this->digits.push_back(0);
+                }
+                divide_by_small_in_place(this->digits.data(), this->digits.size(), divisor, base);
+                this->normalize();
+            }
+
+            /**
+             *  @brief: divides (*this) by a single digit divisor in one pass of divide_by_digit_in_place, with
+             *          the precision and rounding divide_vector gives a one digit divisor: the quotient keeps
+             *          max_error_exponent + 1 digits from the first digit of *this, and its magnitude is raised
+             *          by one unit of the last one if upper and the division is not exact. Divisors of base or
+             *          more go through divide_vector.
+             *  @param: divisor: a positive number
+             *  @param: max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
+             *  @param: upper: if true: the magnitude is rounded up, else down
+             */
+            void divide_by_small(T divisor, unsigned int max_error_exponent, bool upper) {
+                if (divisor == 0) {
+                    throw divide_by_zero();
+                }
+                const T base = limb_traits<T>::base;
+                if (divisor >= base) {
+                    this->divide_vector(exact_number<T>(divisor), max_error_exponent, upper);
+                    return;
+                }
+                // divide_vector leaves a quotient by one as it is
+                if (this->is_zero() || divisor == 1) {
+                    return;
+                }
+
+                // a quotient digit for each digit of *this down to the last one kept
+                this->normalize_left();
+                const size_t length = (size_t) max_error_exponent + 1;
+                bool exact = true;
+                if (this->digits.size() > length) {
+                    exact = std::all_of(this->digits.begin() + length, this->digits.end(), [](T digit) { return digit == 0; });
+                }
+                this->digits.resize(length, 0);
+
+                exact = divide_by_digit_in_place(this->digits.data(), this->digits.size(), divisor, base) == 0 && exact;
+                if (upper && !exact) {
+                    this->push_front(0);
+                    this->exponent++;
+                    propagate_carry(this->digits.data(), this->digits.size(), 1, base - 1);
+                }
+                this->normalize();
+            }
+
+            /**
+             *  @brief: multiplies *this by 2^bits exactly, bits may be negative. With a binary base this adds
+             *          bits / base_bits to the exponent and shifts the digits by the remaining bits, with
+             *          other bases it multiplies by the largest powers of two below the base, or halves
+             *          digit by digit and writes the last half unit as one more digit, base / 2.
+             *  @param: bits: the power of two
+             */
+            void scale_by_power_of_two(int bits) {
+                if (this->is_zero()) {
+                    return;
+                }
+                if constexpr (limb_traits<T>::binary_base) {
+                    const int limb_bits = limb_traits<T>::base_bits;
+                    int whole = bits / limb_bits;
+                    int rest = bits % limb_bits;
+                    if (rest < 0) {
+                        rest += limb_bits;
+                        --whole;
+                    }
+                    T carry = shift_left_in_place(this->digits.data(), this->digits.size(), rest);
+                    if (carry != 0) {
+                        this->push_front(carry);
+                        this->exponent++;
+                    }
+                    this->exponent += whole;
+                } else {
+                    const T base = limb_traits<T>::base;
+                    while (bits > 0) {
+                        T factor = 1;
+                        for (; bits > 0 && factor < base / 2; --bits) {
+                            factor *= 2;
+                        }
+                        T carry = multiply_by_small_in_place(this->digits.data(), this->digits.size(), factor, base);
+                        if (carry != 0) {
+                            this->push_front(carry);
+                            this->exponent++;
+                        }
+                    }
+                    for (; bits < 0; ++bits) {
+                        if (divide_by_small_in_place(this->digits.data(), this->digits.size(), 2, base) != 0) {
+                            this->digits.push_back(base / 2);
+                        }
+                    }
+                }
+                this->normalize();
+            }
+
+            /**
+             *  @brief: TOOM-COOK MULTIPLICATION: multiplies (*this) with other by splitting both numbers in
+             *          k pieces, i.e. into polynomials of degree k - 1 in base^piece_length. Both polynomials
+             *          are evaluated at 2k - 1 points (0, 1, -1, 2, -2, 3 and infinity), the values are
+             *          multiplied pointwise and the 2k - 1 coefficients of the product are interpolated back.
+             *
+             *          The interpolation computes the Newton divided differences of the finite points, whose
+             *          divisions are exact divisions by the small differences between two points, and
+             *          expands the Newton form into the coefficients.
+             *  @param: other: an exact_number to be multiplied with (*this)
+             *  @param: k: number of pieces, 3 for Toom-3 and 4 for Toom-4
+             *  @param: base: base of the numbers being multiplied
+             */
+            void toom_cook_multiplication(
+                    const exact_number<T> &other,
+                    const int k,
+                    const T base = limb_traits<T>::base
+            ) {
                 const int a_size = this->digits.size();
                 const int b_size = other.digits.size();
                 const int a_exponent = this->exponent;
@@ -292,107 +1206,163 @@ namespace boost {
                 const bool b_sign = other.positive;
 
                 const int max_length = std::max(a_size, b_size);
+                const int piece_length = (max_length + k - 1) / k;
 
-                if (max_length <= KARATSUBA_BASE_CASE_THRESHOLD || std::abs(a_size - b_size) > std::min(a_size, b_size)) {
-                    this->standard_multiplication(other, base);
+                // the shorter number must reach its last piece, otherwise there is nothing to gain
+                if (std::min(a_size, b_size) <= (k - 1) * piece_length) {
+                    this->karatsuba_multiplication(other, base);
                     return;
                 }
 
-                // appending zeroes in front to make sizes of a & b equal
-                int a_pref_zeroes = 0, b_pref_zeroes = 0;
-                if (a_size < max_length) {
-                    a_pref_zeroes = max_length - a_size;
-                } else if (b_size < max_length) {
-                    b_pref_zeroes = max_length - b_size;
-                } 
-
-                const int left_half_length = max_length / 2;
-                const int right_half_length = max_length - left_half_length;
+                // pieces[i] is the coefficient of base^(i * piece_length), taken from the right
+                auto split = [&](const std::vector<T> &number) {
+                    std::vector<exact_number<T>> pieces(k);
+                    int end = number.size();
+                    for (int i = 0; i < k; ++i) {
+                        int begin = std::max(0, end - piece_length);
+                        pieces[i] = exact_number<T>(std::vector<T> (number.begin() + begin, number.begin() + end), true);
+                        pieces[i].normalize();
+                        end = begin;
+                    }
+                    return pieces;
+                };
 
-                /*
-                        Variable Explanation
-                    a is vector representation of "this", b is vector representation of "other"
-                    a = exact_al * base^(right_half_length) + exact_ar
-                    b = exact_bl * base^(right_half_length) + exact_br
-                */
-                exact_number<T> exact_al;
-                exact_number<T> exact_ar;
-                exact_number<T> exact_bl;
-                exact_number<T> exact_br;
-
-                if (a_pref_zeroes > 0) {
-                    if (a_pref_zeroes >= left_half_length) {
-                        exact_al = exact_number(std::vector<T> (), true);
-                        exact_ar = exact_number(this->digits, true);
-                    } else {
-                        exact_al = exact_number(std::vector<T> (this->digits.begin(), this->digits.begin() + left_half_length - a_pref_zeroes), true);
-                        exact_ar = exact_number(std::vector<T> (this->digits.begin() + left_half_length - a_pref_zeroes, this->digits.end()), true);
-                    }
-                    exact_bl = exact_number(std::vector<T> (other.digits.begin(), other.digits.begin() + left_half_length), true);
-                    exact_br = exact_number(std::vector<T> (other.digits.begin() + left_half_length, other.digits.end()), true);
-                } else if (b_pref_zeroes > 0) {
-                    if (b_pref_zeroes >= left_half_length) {
-                        exact_bl = exact_number(std::vector<T> (), true);
-                        exact_br = exact_number(other.digits, true);
-                    } else {
-                        exact_bl = exact_number(std::vector<T> (other.digits.begin(), other.digits.begin() + left_half_length - b_pref_zeroes), true);
-                        exact_br = exact_number(std::vector<T> (other.digits.begin() + left_half_length - b_pref_zeroes, other.digits.end()), true);
+                // evaluates the polynomial with Horner's rule at a small integer point
+                auto evaluate = [&](const std::vector<exact_number<T>> &pieces, int x) {
+                    if (x == 0) {
+                        return pieces[0];
                     }
-                    exact_al = exact_number(std::vector<T> (this->digits.begin(), this->digits.begin() + left_half_length), true);
-                    exact_ar = exact_number(std::vector<T> (this->digits.begin() + left_half_length, this->digits.end()), true);
-                } else {
-                    exact_al = exact_number(std::vector<T> (this->digits.begin(), this->digits.begin() + left_half_length), true);
-                    exact_ar = exact_number(std::vector<T> (this->digits.begin() + left_half_length, this->digits.end()), true);
-                    exact_bl = exact_number(std::vector<T> (other.digits.begin(), other.digits.begin() + left_half_length), true);
-                    exact_br = exact_number(std::vector<T> (other.digits.begin() + left_half_length, other.digits.end()), true);
-                }
+                    exact_number<T> value = pieces[k - 1];
+                    for (int i = k - 2; i >= 0; --i) {
+                        if (x != 1 && x != -1) {
+                            value.multiply_by_small(std::abs(x), base);
+                        }
+                        if (x < 0) {
+                            value.positive = !value.positive;
+                        }
+                        value.signed_add_vector(pieces[i], false, base - 1);
+                    }
+                    return value;
+                };
 
-                exact_al.normalize();
-                exact_bl.normalize();
-                exact_ar.normalize();
-                exact_br.normalize();
+                // a square evaluates its only polynomial once and squares the values pointwise
+                const bool square = (this == &other);
+                const std::vector<exact_number<T>> a_pieces = split(this->digits);
+                const std::vector<exact_number<T>> b_pieces = square ? std::vector<exact_number<T>>() : split(other.digits);
 
-                exact_number<T> sum_al_ar (exact_al);
-                exact_number<T> sum_bl_br (exact_bl);
+                // finite evaluation points 0, 1, -1, 2, -2, 3, ...
+                const int points = 2 * k - 2;
+                std::vector<int> x(points);
+                for (int i = 0; i < points; ++i) {
+                    x[i] = (i % 2 == 1) ? (i + 1) / 2 : -(i / 2);
+                }
 
-                /*
-                    Variable explanation
-                    sum_al_ar = al + ar
-                    sum_bl_br = bl + br
-                */
-                sum_al_ar.add_vector(exact_ar, base - 1);
-                sum_bl_br.add_vector(exact_br, base - 1);
+                exact_number<T> product_at_infinity = a_pieces[k - 1];
+                if (square) {
+                    product_at_infinity.square(base);
+                } else {
+                    product_at_infinity.multiply_vector(b_pieces[k - 1], base);
+                }
 
-                exact_al.karatsuba_multiplication(exact_bl, base);
-                sum_al_ar.karatsuba_multiplication(sum_bl_br, base);
-                exact_ar.karatsuba_multiplication(exact_br, base);
-                /*
-                    Variable explanation
-                    exact_al = al * bl
-                    sum_al_ar = (al + ar) * (bl + br)
-                    exact_ar = ar * br
-                */
+                std::vector<exact_number<T>> r(points);
+                for (int i = 0; i < points; ++i) {
+                    r[i] = evaluate(a_pieces, x[i]);
+                    if (square) {
+                        r[i].square(base);
+                    } else {
+                        r[i].multiply_vector(evaluate(b_pieces, x[i]), base);
+                    }
 
-                sum_al_ar.subtract_vector(exact_al, base - 1);
-                sum_al_ar.subtract_vector(exact_ar, base - 1);
-                /*
-                    sum_al_ar = al * br + ar * bl
-                */
+                    // removes the leading coefficient, so that r holds a polynomial of degree points - 1
+                    if (x[i] != 0) {
+                        exact_number<T> top = product_at_infinity;
+                        for (int j = 0; j < points; ++j) {
+                            top.multiply_by_small(std::abs(x[i]), base);
+                        }
+                        r[i].signed_add_vector(top, true, base - 1);
+                    }
+                }
 
-                // multiply exact_al by base^(2 * right_half_length)
-                exact_al.exponent += 2 * right_half_length;
+                // Newton divided differences, r[i] becomes the coefficient of (x - x[0]) ... (x - x[i - 1])
+                for (int level = 1; level < points; ++level) {
+                    for (int i = points - 1; i >= level; --i) {
+                        r[i].signed_add_vector(r[i - 1], true, base - 1);
+                        const int difference = x[i] - x[i - level];
+                        r[i].exact_divide_by_small(std::abs(difference), base);
+                        if (difference < 0) {
+                            r[i].positive = !r[i].positive;
+                        }
+                    }
+                }
 
-                // multiply sum_al_ar by base^(right_half_length)
-                sum_al_ar.exponent += right_half_length;
+                // expands the Newton form into coefficients, c[i] is the coefficient of x^i
+                std::vector<exact_number<T>> c {r[points - 1]};
+                for (int i = points - 2; i >= 0; --i) {
+                    c.push_back(c.back());
+                    for (int j = (int)c.size() - 2; j >= 0; --j) {
+                        exact_number<T> scaled = c[j];
+                        if (x[i] != 0) {
+                            scaled.multiply_by_small(std::abs(x[i]), base);
+                        }
+                        const bool subtract = (x[i] > 0);
+                        if (j == 0) {
+                            c[0] = r[i];
+                        } else {
+                            c[j] = c[j - 1];
+                        }
+                        if (x[i] != 0) {
+                            c[j].signed_add_vector(scaled, subtract, base - 1);
+                        }
+                    }
+                }
 
-                exact_al.add_vector(sum_al_ar, base - 1);
-                exact_al.add_vector(exact_ar, base - 1);
+                // c[i] * base^(i * piece_length) are the (non negative) terms of the product
+                exact_number<T> result = product_at_infinity;
+                result.exponent += points * piece_length;
+                for (int i = 0; i < points; ++i) {
+                    c[i].exponent += i * piece_length;
+                    result.add_vector(c[i], base - 1);
+                }
 
-                *this = exact_al;
+                *this = result;
                 this->exponent += -(a_size + b_size) + (a_exponent + b_exponent);
                 this->positive = (a_sign == b_sign);
                 this->normalize();
+            }
+
+            /// number of transform primes the product of *this and other needs, 0 if ntt_multiplication cannot take it
+            int ntt_primes_needed(const exact_number<T> &other, const T base) const {
+                if constexpr (detail::ntt_supports_limb<T>()) {
+                    return detail::ntt_primes_needed(this->digits.size(), other.digits.size(), base);
+                } else {
+                    return 0;
+                }
+            }
 
+            /**
+             *  @brief: NTT MULTIPLICATION: multiplies (*this) with other by convolving their digits with number
+             *          theoretic transforms modulo up to five primes and rebuilding the exact product with
+             *          the chinese remainder theorem (see ntt.hpp). Products whose coefficients the primes
+             *          cannot hold, or limbs without a wide type, fall back to Toom-4.
+             *  @param: other: an exact_number to be multiplied with (*this)
+             *  @param: base: base of the numbers being multiplied
+             */
+            void ntt_multiplication(const exact_number<T> &other, const T base = limb_traits<T>::base) {
+                const int primes = ntt_primes_needed(other, base);
+                if (primes == 0) {
+                    this->toom_cook_multiplication(other, 4, base);
+                    return;
+                }
+
+                if constexpr (detail::ntt_supports_limb<T>()) {
+                    // the product of two integers of n and m digits has n + m digits
+                    const std::vector<T> a = this->digits;
+                    this->digits = (this == &other) ? detail::ntt_multiply(a, a, base, primes)
+                                                    : detail::ntt_multiply(a, std::vector<T>(other.digits), base, primes);
+                    this->exponent += other.exponent;
+                    this->positive = (this->positive == other.positive);
+                    this->normalize();
+                }
             }
 
             //Performs long division on dividend by divisor and returns result in quotient
@@ -400,13 +1370,11 @@ namespace boost {
                     const std::vector<T>& dividend,
                     const std::vector<T>& divisor,
                     std::vector<T>& quotient,
-                    T base = (std::numeric_limits<T>::max() / 4) * 2
+                    T base = limb_traits<T>::base
             ) {
                 /*
-                 *   Currently knuths algorithm has been implemented for long division, the
-                 *   algorithm can be refined furthur as to make significant optimisations
-                 *   in time complexity. Later on more algorithms like Ziegler burnikel algorithm
-                 *   can be implemented and proper benchmarking would give better results.
+                 *   knuth_division runs Algorithm D, and Burnikel-Ziegler's recursive division
+                 *   for divisors of threshold_set::burnikel_ziegler digits or more.
                  */
 
                 std::vector<T> zero = {0}, remainder;
@@ -420,17 +1388,279 @@ namespace boost {
                 return remainder;
             }
 
-            /** 
-             *   @brief:  "KNUTH DIVISION" computes quotient and remainder when dividend is divided by divisor using 
-             *            knuth's algorithm (Not exactly knuth's Algorithm due to design constraints).
+            /**
+             *  @brief: divides the two digit number hi * base + lo by divisor, hi <= divisor, so that the
+             *          quotient is at most base + 1 and fits in T
+             */
+            static void divide_two_by_one(T hi, T lo, T divisor, T base, T &quotient, T &remainder) {
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    const wide_type numerator = (wide_type) hi * (wide_type) base + (wide_type) lo;
+                    quotient = (T) (numerator / (wide_type) divisor);
+                    remainder = (T) (numerator % (wide_type) divisor);
+                } else {
+                    // hi * base = quotient * divisor + remainder, remainder + lo < divisor + base fits in T
+                    quotient = mult_div(hi, base, divisor);
+                    remainder = mul_mod(hi, base, divisor) + lo;
+                    quotient += remainder / divisor;
+                    remainder %= divisor;
+                }
+            }
+
+            /**
+             *  @brief: divides the digit span r[0..n) by a single digit divisor in place, walking from the
+             *          highest to the lowest digit. Every step divides rem * base + r[i], which is lower than
+             *          divisor * base, so its quotient is a digit.
+             *
+             *          With a wide type, no step runs a hardware division: powers of two are divided with a
+             *          shift and a mask, and any other divisor with the 2-by-1 division of Moller and
+             *          Granlund in words of half the wide type, using a reciprocal computed once per call.
+             *  @return: the remainder of the division
+             *  @ref:    N. Moller, T. Granlund, Improved division by invariant integers, IEEE Trans. on
+             *           Computers 60 (2011), Algorithm 4
+             */
+            static T divide_by_digit_in_place(T* r, size_t n, T divisor, T base) {
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    const wide_type wide_base = base;
+
+                    if ((divisor & (divisor - 1)) == 0) {
+                        int shift = 0;
+                        while (((T) 1 << shift) != divisor) {
+                            ++shift;
+                        }
+                        const wide_type mask = (wide_type) divisor - 1;
+
+                        wide_type rem = 0;
+                        for (size_t i = 0; i < n; ++i) {
+                            wide_type t = rem * wide_base + (wide_type) r[i];
+                            r[i] = (T) (t >> shift);
+                            rem = t & mask;
+                        }
+                        return (T) rem;
+                    }
+
+                    // words of half the wide type, beta = 2^word_bits. The divisor is shifted until its top
+                    // bit is set, and the reciprocal is v = floor((beta^2 - 1) / d) - beta
+                    constexpr int word_bits = 4 * sizeof(wide_type);
+                    const wide_type word_mask = ((wide_type) 1 << word_bits) - 1;
+                    int shift = 0;
+                    while ((((wide_type) divisor << shift) >> (word_bits - 1)) == 0) {
+                        ++shift;
+                    }
+                    const wide_type d = (wide_type) divisor << shift;
+                    const wide_type v = ~(wide_type) 0 / d - ((wide_type) 1 << word_bits);
+
+                    // the remainder is kept shifted, as remainder << shift, all along the loop
+                    wide_type remainder = 0;
+                    for (size_t i = 0; i < n; ++i) {
+                        // u = (rem * base + r[i]) << shift < d * beta, so its high word is lower than d
+                        const wide_type u = remainder * wide_base + ((wide_type) r[i] << shift);
+                        const wide_type u1 = u >> word_bits;
+                        const wide_type u0 = u & word_mask;
+
+                        // the double word products wrap modulo beta^2, the single word ones modulo beta
+                        const wide_type estimate = v * u1 + u;
+                        wide_type q = ((estimate >> word_bits) + 1) & word_mask;
+                        remainder = (u0 - q * d) & word_mask;
+                        // taken about half of the time, so it is applied through a mask instead of a branch
+                        const wide_type adjust = (wide_type) 0 - (wide_type) (remainder > (estimate & word_mask));
+                        q = (q + adjust) & word_mask;
+                        remainder = (remainder + (d & adjust)) & word_mask;
+                        if (remainder >= d) {
+                            ++q;
+                            remainder -= d;
+                        }
+
+                        r[i] = (T) q;
+                    }
+                    return (T) (remainder >> shift);
+                } else {
+                    T rem = 0;
+                    for (size_t i = 0; i < n; ++i) {
+                        divide_two_by_one(rem, r[i], divisor, base, r[i], rem);
+                    }
+                    return rem;
+                }
+            }
+
+            /**
+             *  @brief: subtracts q * v[0..n) from the digit span r[0..n) in place, walking from the lowest to
+             *          the highest digit
+             *  @return: the digit that still has to be subtracted above r[0], at most q
+             */
+            static T subtract_multiple_in_place(T* r, const T* v, size_t n, T q, T base) {
+                T carry = 0;
+                for (size_t i = n; i-- > 0;) {
+                    T product_digit;
+                    if constexpr (limb_traits<T>::has_wide_type) {
+                        using wide_type = typename limb_traits<T>::wide_type;
+                        wide_type t = (wide_type) q * (wide_type) v[i] + (wide_type) carry;
+                        product_digit = (T) (t % (wide_type) base);
+                        carry = (T) (t / (wide_type) base);
+                    } else {
+                        product_digit = mul_mod(q, v[i], base);
+                        T q_digit = mult_div(q, v[i], base);
+                        if (product_digit >= base - carry) {
+                            product_digit -= base - carry;
+                            ++q_digit;
+                        } else {
+                            product_digit += carry;
+                        }
+                        carry = q_digit;
+                    }
+
+                    if (r[i] >= product_digit) {
+                        r[i] -= product_digit;
+                    } else {
+                        r[i] += base - product_digit;
+                        ++carry;
+                    }
+                }
+                return carry;
+            }
+
+            /**
+             *  @brief: ALGORITHM D: schoolbook division of the digit span u[0..nu) by v[0..n) in place, most
+             *          significant digit first. Every quotient digit is estimated from the two leading
+             *          digits of the partial remainder and the leading digit of v, corrected with the
+             *          second digit of v, so that it is off by at most one before the multiply-subtract
+             *          step, which adds v back in that rare case.
+             *  @param: q: the nu - n digits of the quotient
+             *  @param: u: the dividend, u[0..n) < v. Holds the remainder in u[nu - n..nu) on return
+             *  @param: v: the divisor, n >= 2 digits with v[0] >= base / 2
+             *  @ref:    The Art of Computer Programming, Vol 2, 4.3.1 Algorithm D
+             */
+            static void divide_basecase(T* q, T* u, size_t nu, const T* v, size_t n, T base) {
+                const T max_digit = base - 1;
+
+                for (size_t j = 0; j + n < nu; ++j) {
+                    // the partial remainder u[j..j + n] is lower than v * base, so its quotient is a digit
+                    T* w = u + j;
+                    T q_hat, r_hat;
+                    divide_two_by_one(w[0], w[1], v[0], base, q_hat, r_hat);
+
+                    while (q_hat > max_digit || (r_hat < base && two_digits_greater(q_hat, v[1], r_hat, w[2], base))) {
+                        --q_hat;
+                        r_hat += v[0];
+                    }
+
+                    T borrow = subtract_multiple_in_place(w + 1, v, n, q_hat, base);
+                    if (w[0] < borrow) {
+                        --q_hat;
+                        add_in_place(w + 1, v, n, max_digit);
+                    }
+                    w[0] = 0;
+                    q[j] = q_hat;
+                }
+            }
+
+            /// whether x * y > hi * base + lo, for digits x, y, hi and lo
+            static bool two_digits_greater(T x, T y, T hi, T lo, T base) {
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    using wide_type = typename limb_traits<T>::wide_type;
+                    return (wide_type) x * (wide_type) y > (wide_type) hi * (wide_type) base + (wide_type) lo;
+                } else {
+                    T product_hi = mult_div(x, y, base);
+                    return product_hi > hi || (product_hi == hi && mul_mod(x, y, base) > lo);
+                }
+            }
+
+            /// r[0..na + nb) = a[0..na) * b[0..nb) with the algorithm multiply_vector picks for the sizes
+            static void multiply_spans(T* r, const T* a, size_t na, const T* b, size_t nb, T base) {
+                exact_number<T> product(std::vector<T> (a, a + na), (int) na, true);
+                exact_number<T> factor(std::vector<T> (b, b + nb), (int) nb, true);
+                product.multiply_vector(factor, base);
+
+                std::fill(r, r + na + nb, 0);
+                // a non zero integer has a positive exponent, its digits end at or before r[na + nb - 1]
+                if (product.exponent > 0) {
+                    std::copy(product.digits.begin(), product.digits.end(), r + na + nb - product.exponent);
+                }
+            }
+
+            /**
+             *  @brief: BURNIKEL-ZIEGLER: q[0..n) and r[0..n) are the quotient and remainder of a[0..2n) by
+             *          b[0..n), for a < b * base^n and b[0] >= base / 2. The division is split into two
+             *          3h by 2h divisions of half the size, which recurse back here, so the cost is
+             *          O(M(n) log n) where M(n) is the cost of a product of n digits.
+             *  @ref:    C. Burnikel, J. Ziegler, Fast Recursive Division, MPI-I-98-1-022
+             */
+            static void burnikel_ziegler_2n_by_n(T* q, T* r, const T* a, const T* b, size_t n, T base) {
+                if (n % 2 == 1 || n < (size_t) algorithm_thresholds<T>::get().burnikel_ziegler || n < 4) {
+                    std::vector<T> u(a, a + 2 * n);
+                    divide_basecase(q, u.data(), 2 * n, b, n, base);
+                    std::copy(u.begin() + n, u.end(), r);
+                    return;
+                }
+
+                const size_t h = n / 2;
+                std::vector<T> partial(3 * h);
+                burnikel_ziegler_3n_by_2n(q, partial.data(), a, b, h, base);
+                std::copy(a + 3 * h, a + 4 * h, partial.begin() + 2 * h);
+                burnikel_ziegler_3n_by_2n(q + h, r, partial.data(), b, h, base);
+            }
+
+            /**
+             *  @brief: q[0..h) and r[0..2h) are the quotient and remainder of a[0..3h) = [a1, a2, a3] by
+             *          b[0..2h) = [b1, b2], for a < b * base^h. The quotient of [a1, a2] by b1 is off by at
+             *          most two from the true quotient, which the remainder [r1, a3] - q * b2 corrects.
+             */
+            static void burnikel_ziegler_3n_by_2n(T* q, T* r, const T* a, const T* b, size_t h, T base) {
+                const T max_digit = base - 1;
+                const size_t n = 2 * h;
+
+                // remainder is [r1, a3] with one more leading digit, r1 might reach h + 1 digits
+                std::vector<T> remainder(n + 1, 0);
+                if (compare_spans(a, h, b, h) < 0) {
+                    burnikel_ziegler_2n_by_n(q, remainder.data() + 1, a, b, h, base);
+                } else {
+                    // a1 = b1, so q = base^h - 1 and r1 = [a1, a2] - q * b1 = a2 + b1
+                    std::fill(q, q + h, max_digit);
+                    std::copy(a + h, a + n, remainder.begin() + 1);
+                    remainder[0] = add_in_place(remainder.data() + 1, b, h, max_digit);
+                }
+                std::copy(a + n, a + n + h, remainder.begin() + h + 1);
+
+                std::vector<T> product(n + 1, 0);
+                multiply_spans(product.data() + 1, q, h, b + h, h, base);
+
+                if (compare_spans(remainder.data(), n + 1, product.data(), n + 1) >= 0) {
+                    subtract_in_place(remainder.data(), product.data(), n + 1, max_digit);
+                    std::copy(remainder.begin() + 1, remainder.end(), r);
+                    return;
+                }
+
+                // the remainder is negative: adds b back, at most twice, taking one from q every time
+                std::vector<T> &deficit = product;
+                subtract_in_place(deficit.data(), remainder.data(), n + 1, max_digit);
+                while (true) {
+                    propagate_borrow(q, h, 1, max_digit);
+                    if (compare_spans(deficit.data(), n + 1, b, n) <= 0) {
+                        std::copy(b, b + n, r);
+                        subtract_in_place(r, deficit.data() + 1, n, max_digit);
+                        return;
+                    }
+                    T borrow = subtract_in_place(deficit.data() + 1, b, n, max_digit);
+                    propagate_borrow(deficit.data(), 1, borrow, max_digit);
+                }
+            }
+
+            /**
+             *   @brief:  "KNUTH DIVISION" computes quotient and remainder when dividend is divided by divisor.
+             *            Both are normalized by a single digit factor, so that the leading digit of the
+             *            divisor is at least base / 2. Short divisors go through divide_basecase, divisors
+             *            of threshold_set::burnikel_ziegler digits or more through the recursive division, one
+             *            block of the divisor's size at a time.
              *            Valid only for integers.
              *   @param: dividend  - vector of any size to be divided
              *   @param: divisor   - vector of any size which divides
-             *   @param: quotient  - Empty vector in which quotient is returned
-             *   @param: remainder - Empty vector in which remainder is returned
+             *   @param: quotient  - Empty vector in which quotient is returned, without leading zeros
+             *   @param: remainder - Empty vector in which remainder is returned, without leading zeros ({0} if
+             *                       the division is exact)
              *   @param: Base      - Base of integer vectors dividend and divisor provided
              *   @author: Kishan Shukla
-             *   @ref:    The Art of Computer Programming, Vol 2, 4.33 Algorithm D
+             *   @ref:    The Art of Computer Programming, Vol 2, 4.3.1 Algorithm D
              */
 
             static void knuth_division(
@@ -438,281 +1668,105 @@ namespace boost {
                     const std::vector<T>& divisor,
                     std::vector<T>& quotient,
                     std::vector<T>& remainder,
-                    T base = (std::numeric_limits<T>::max() / 4) * 2){
+                    T base = limb_traits<T>::base){
 
-                exact_number<T> tmp;
-                std::vector<T> aligned_dividend = dividend;
-                std::vector<T> aligned_divisor = divisor;
-                size_t idx = 0;
-                while (idx < aligned_dividend.size() && aligned_dividend[idx] == 0) {
-                    idx++;
-                }
-                aligned_dividend.erase(aligned_dividend.begin(), aligned_dividend.begin() + idx);
+                auto first_non_zero = [](auto &digits) {
+                    return std::find_if(digits.begin(), digits.end(), [](T d) { return d != 0; });
+                };
 
+                std::vector<T> aligned_dividend(first_non_zero(dividend), dividend.end());
+                std::vector<T> aligned_divisor(first_non_zero(divisor), divisor.end());
+
+                if (aligned_divisor.empty()) {
+                    throw divide_by_zero();
+                }
                 if (aligned_dividend.empty()) {
                     quotient.clear();
                     remainder.clear();
                     return;
                 }
-                if ((aligned_dividend.size() == aligned_divisor.size() && 
-                        tmp.aligned_vectors_is_lower(aligned_dividend, aligned_divisor)) || 
-                            aligned_dividend.size() < aligned_divisor.size()) {
-                    quotient.clear();
-                    remainder = aligned_dividend;
-                    return;
-                }
-
-                if ((int)divisor.size() == 1) {
-                    division_by_single_digit(dividend, divisor, quotient, remainder, base);
-                    return;
-                }
-
-                exact_number<T> exact_divisor, exact_dividend;
-
-                exact_dividend.digits = dividend;
-                exact_dividend.exponent = dividend.size();
-                exact_dividend.normalize();
-
-                exact_divisor.digits = divisor;
-                exact_divisor.exponent = divisor.size();
-                exact_divisor.normalize();
-
-                if (exact_divisor.digits[0] == 0) {
-                    throw divide_by_zero();
+                if (compare_spans(aligned_dividend.data(), aligned_dividend.size(), aligned_divisor.data(), aligned_divisor.size()) < 0) {
+                    quotient.clear();
+                    remainder = aligned_dividend;
+                    return;
                 }
 
-                exact_number<T> zero("0");
-                static exact_number<T> one_exact("1");
-                static exact_number<T> two_exact("2");
-
-                int normalization_factor = 0;
-                while (exact_divisor.digits[0] < base / 2) {
-                    exact_divisor.multiply_vector(two_exact, base);
-                    exact_dividend.multiply_vector(two_exact, base);
-                    normalization_factor++;
+                if (aligned_divisor.size() == 1) {
+                    const T rem = divide_by_digit_in_place(aligned_dividend.data(), aligned_dividend.size(), aligned_divisor[0], base);
+                    quotient.assign(first_non_zero(aligned_dividend), aligned_dividend.end());
+                    remainder = {rem};
+                    return;
                 }
 
-                //   To make the most significant bit of divisor >= (base/2) (which is required
-                //   for the correctness of the algorithm), we multiply the numerator and the
-                //   denominator by a factor of d as it won't affect our answer
-
-                while (exact_divisor.exponent - (int)exact_divisor.digits.size() > 0) {
-                    exact_divisor.digits.push_back(0);
+                // multiplying both numbers by factor leaves the quotient as it is and brings the leading
+                // digit of the divisor to base / 2 or more, which the quotient digit estimates rely on
+                const T factor = base / (aligned_divisor[0] + 1);
+                size_t n = aligned_divisor.size();
+                std::vector<T> v = aligned_divisor;
+                std::vector<T> u(aligned_dividend.size() + 1, 0);
+                std::copy(aligned_dividend.begin(), aligned_dividend.end(), u.begin() + 1);
+                if (factor > 1) {
+                    multiply_by_small_in_place(v.data(), n, factor, base);
+                    u[0] = multiply_by_small_in_place(u.data() + 1, aligned_dividend.size(), factor, base);
                 }
-                while (exact_dividend.exponent - (int)exact_dividend.digits.size() > 0) {
-                    exact_dividend.digits.push_back(0);
-                }
-
-                int n = exact_divisor.digits.size();
-                int m = exact_dividend.digits.size();
 
-                if (m < n) {
-                    // divisor = remainder and quotient = 0
-                    quotient.push_back(0);
-                    remainder = exact_divisor.digits;
-                } else if (m == n){
-                    if (exact_dividend < exact_divisor) {
-                        remainder = exact_dividend.digits;
-                        quotient.push_back(0);
-                    }
-                    /*
-                     *  Following block of code is bit inefficient. Complexity for following 
-                     *  is log(base). It calculates quotient digit when dividend and divisor are
-                     *  of same size. Doing a bit research may yield some method with constant
-                     *  complexity.
-                     */
-                    else {
-
-                        T left = 1, right = base - 1, mid = (right - left) / 2 + left;
-
-                        // Binary search to obtain single quotient digit. loop runs less
-                        // than log(base) number of times
-                        exact_number<T> temp_dividend, temp_quotient;
-                        while (left <= right) {
-
-                            mid = (right - left) / 2 + left;
-                            temp_quotient.digits = {mid};
-                            temp_quotient.exponent = 1;
-                            temp_dividend = exact_dividend;
-                            temp_quotient.multiply_vector(exact_divisor, base);
-
-                            if (temp_quotient > temp_dividend) {
-                                right = mid - 1;
-                            } else if (temp_quotient == temp_dividend) {
-                                temp_dividend = zero;
-                                break;
-                            } else {
-                                temp_dividend.subtract_vector(temp_quotient, base - 1);
-                                if (temp_dividend < exact_divisor) {
-                                    break;
-                                } else if (temp_dividend == exact_divisor) {
-                                    mid++;
-                                    temp_dividend = zero;
-                                    break;
-                                } else {
-                                    left = mid + 1;
-                                }
-                            }
-                        }
-                        quotient.push_back(mid);
-                        temp_dividend.normalize();
-                        while (temp_dividend.exponent - (int)temp_dividend.digits.size() > 0) {
-                            temp_dividend.digits.push_back(0);
-                        }
-                        remainder = temp_dividend.digits;
+                std::vector<T> q;
+                size_t shift = 0;
+                if (n < (size_t) algorithm_thresholds<T>::get().burnikel_ziegler) {
+                    q.resize(u.size() - n);
+                    divide_basecase(q.data(), u.data(), u.size(), v.data(), n, base);
+                } else {
+                    // pads the divisor with zeros to block = j * 2^k digits, j < threshold_set::burnikel_ziegler, so
+                    // that halving the blocks down to the threshold never meets an odd size
+                    size_t levels = 0;
+                    while ((n >> levels) >= (size_t) algorithm_thresholds<T>::get().burnikel_ziegler) {
+                        ++levels;
                     }
+                    const size_t block = ((n + (1 << levels) - 1) >> levels) << levels;
+                    shift = block - n;
+                    v.resize(block, 0);
+                    u.resize(u.size() + shift, 0);
+
+                    // splits u in blocks from its lowest digit, the top block must be lower than the divisor
+                    u.erase(u.begin(), first_non_zero(u));
+                    const size_t blocks = (u.size() + block - 1) / block;
+                    u.insert(u.begin(), blocks * block - u.size() + 1, 0);
+                    q.resize(1 + (blocks - 1) * block);
+
+                    // otherwise the top block is reduced by a single quotient digit, q[0]
+                    std::vector<T> partial(2 * block);
+                    if (compare_spans(u.data() + 1, block, v.data(), block) >= 0) {
+                        divide_basecase(q.data(), u.data(), block + 1, v.data(), block, base);
+                    }
+                    std::copy(u.begin() + 1, u.begin() + 1 + block, partial.begin());
+                    for (size_t i = 1; i < blocks; ++i) {
+                        std::copy(u.begin() + 1 + i * block, u.begin() + 1 + (i + 1) * block, partial.begin() + block);
+                        burnikel_ziegler_2n_by_n(q.data() + 1 + (i - 1) * block, partial.data(), partial.data(), v.data(), block, base);
+                    }
+                    std::copy(partial.begin(), partial.begin() + block, u.end() - block);
                 }
-                else {
-                    exact_number<T> exact_base(std::vector<T> {1, 0}, 2, true);
-
-                    std::vector<T> dividend_part(exact_dividend.digits.begin(), exact_dividend.digits.begin() + n);
-                    exact_number<T> temp_dividend(dividend_part, n, true);
-                    
-                    exact_number<T> first_digit, second_digit, temp_quotient, temp;
-                    std::vector<T> quotient_digit, temp_remainder;
-
-                    for (long int j = n; j < m; ++j) {
-                        temp_dividend.digits.push_back(exact_dividend.digits[j]);
-                        temp_dividend.exponent++;
-                        if (temp_dividend == zero) {
-                            temp_dividend.clear();
-                            temp_dividend.exponent = 0;
-                        }
-                        while (temp_dividend < exact_divisor) {
-                            if (j == m - 1) {
-                                break;
-                            }
-                            j++;
-                            temp_dividend.digits.push_back(exact_dividend.digits[j]);
-                            temp_dividend.exponent++;
-                            quotient.push_back(0);
-                        }
-
-                        if (temp_dividend < exact_divisor) {
-                            quotient.push_back(0);
-                            temp_dividend.normalize();
-                            remainder = temp_dividend.digits;
-                            while (temp_dividend.exponent - (long int)temp_dividend.digits.size() > 0) {
-                                remainder.push_back(0);
-                                temp_dividend.exponent--;
-                            }
-                            break;
-                        }
-
-                        /*
-                         *  Following block of code is bit inefficient. Complexity for following 
-                         *  is log(base). It calculates quotient digit when dividend and divisor are
-                         *  of same size. Doing a bit research may yield some method with constant
-                         *  complexity.
-                         */
-                        if ((int)temp_dividend.digits.size() == n) {
-
-                            T left = 1, right = base - 1, mid = (right - left) / 2 + left;
-
-                            // Binary search to obtain single quotient digit. loop runs less
-                            // than log(base) number of times
-
-                            exact_number<T> temp_dividend2;
-                            while (left <= right) {
-
-                                mid = (right - left) / 2 + left;
-                                temp_quotient.digits = {mid};
-                                temp_quotient.exponent = 1;
-                                temp_dividend2 = temp_dividend;
-                                temp_quotient.multiply_vector(exact_divisor, base);
-
-                                if (temp_quotient > temp_dividend2) {
-                                    right = mid - 1;
-                                } else if (temp_quotient == temp_dividend2) {
-                                    temp_dividend2 = zero;
-                                    break;
-                                } else {
-                                    temp_dividend2.subtract_vector(temp_quotient, base - 1);
-                                    if (temp_dividend2 < exact_divisor) {
-                                        break;
-                                    } else if (temp_dividend2 == exact_divisor){
-                                        mid++;
-                                        temp_dividend2 = zero;
-                                        break;
-                                    } else {
-                                        left = mid + 1;
-                                    }
-                                }
-                            }
-                            quotient.push_back(mid);
-                            temp_dividend = temp_dividend2;
-                            temp_dividend.normalize();
-                            if (temp_dividend == zero) {
-                                temp_dividend.digits.clear();
-                                continue;
-                            }
-                            while (temp_dividend.exponent - (int)temp_dividend.digits.size() > 0) {
-                                temp_dividend.digits.push_back(0);
-                            }
-                            if (j == m - 1) {
-                                remainder = temp_dividend.digits;
-                                break;
-                            } else {
-                                continue;
-                            }
-                        }
-                        temp_dividend.exponent = n + 1;
-
-                        first_digit.digits = {temp_dividend.digits[0]};
-                        second_digit.digits = {temp_dividend.digits[1]};
-                        first_digit.exponent = 1;
-                        second_digit.exponent = 1;
-                        first_digit.multiply_vector(exact_base, base);
-                        first_digit.add_vector(second_digit, base);
-                        while (first_digit.exponent > (int)first_digit.digits.size()) {
-                            first_digit.digits.push_back(0);
-                        }
-
-                        quotient_digit.clear(); temp_remainder.clear();
-                        first_digit.division_by_single_digit(first_digit.digits,
-                            std::vector<T> {exact_divisor[0]}, quotient_digit, temp_remainder, base);
-
-                        temp_quotient.digits = quotient_digit;
-                        temp_quotient.exponent = quotient_digit.size();
-                        temp = temp_quotient;
-                        temp.multiply_vector(exact_divisor, base);
-                        while (temp > temp_dividend) {
-                            temp_quotient.subtract_vector(one_exact, base - 1);
-                            temp = temp_quotient;
-                            temp.multiply_vector(exact_divisor, base);
-                        }
-                        while (temp_quotient.exponent - (int)temp_quotient.digits.size() > 0) {
-                            temp_quotient.digits.push_back(0);
-                        }
-                        quotient.insert(quotient.end(), temp_quotient.digits.begin(), temp_quotient.digits.end());
 
-                        temp_dividend.subtract_vector(temp, base - 1);
-                        temp_dividend.normalize();
-                        while (temp_dividend.exponent - (int)temp_dividend.digits.size() > 0) {
-                            temp_dividend.digits.push_back(0);
-                        }
-                        if (j == m - 1) {
-                            remainder = temp_dividend.digits;
-                        }
-                        if (temp_dividend == zero) {
-                            temp_dividend.digits.clear();
-                        }
-                    }
+                // the remainder is the last n digits of u (before the padding), divided back by factor
+                std::vector<T> r(u.end() - shift - n, u.end() - shift);
+                if (factor > 1) {
+                    divide_by_digit_in_place(r.data(), n, factor, base);
                 }
-                if (normalization_factor >= 1) {
-                    T factor = 1 << normalization_factor;
-                    std::vector<T> temp = remainder, tempr;
-                    remainder.clear();
-                    division_by_single_digit(temp, std::vector<T> {factor}, remainder, tempr, base);
+
+                quotient.assign(first_non_zero(q), q.end());
+                remainder.assign(first_non_zero(r), r.end());
+                if (remainder.empty()) {
+                    remainder.push_back(0);
                 }
             }
 
             /** 
-             *  @brief: divides a vector by single digit divisor using modified (optimized) long division 
+             *  @brief: divides a vector by single digit divisor with divide_by_digit_in_place, in a single
+             *          pass and without any allocation but the quotient's
              *  @param: dividend: a vector to be divided by divisor, can be of any size
              *  @param: divisor: a vector of size 1
-             *  @param: quotient: an empty vector in which quotient is returned
-             *  @param: remainder: an empty vector in which remainder is returned
+             *  @param: quotient: an empty vector in which quotient is returned, without leading zeros ({0} if
+             *          the dividend is lower than the divisor)
+             *  @param: remainder: an empty vector in which the remainder digit is returned
              *  @author: Kishan Shukla
              */
 
@@ -721,120 +1775,160 @@ namespace boost {
                     const std::vector<T> & divisor,
                     std::vector<T> & quotient,
                     std::vector<T> & remainder,
-                    T base = (std::numeric_limits<T>::max() / 4) * 2){
+                    T base = limb_traits<T>::base){
 
                 // division by zero exception
                 if (divisor[0] == 0) {
                     throw divide_by_zero();
                 }
 
-                // if Divisor is one then => quotient = dividend, remainder=0
-                if (divisor[0] == 1) {
-                    for(auto x : dividend) {
-                        quotient.push_back(x);
-                    }
-                    remainder.push_back(0);
-                    return;
+                size_t leading_zeros = 0;
+                while (leading_zeros + 1 < dividend.size() && dividend[leading_zeros] == 0) {
+                    ++leading_zeros;
                 }
-
-                int dividend_size = dividend.size();
-
-                // if dividend size is one, then the operation is simply integer division
-                if (dividend_size == 1) {
-                    T a = dividend[0];
-                    T b = divisor[0];
-                    quotient.push_back(a / b);
-                    remainder.push_back(a % b);
-                    return;
+                quotient.assign(dividend.begin() + leading_zeros, dividend.end());
+                if (quotient.empty()) {
+                    quotient.push_back(0);
                 }
 
-                exact_number<T> exact_remainder, exact_divisor;
-                exact_remainder.digits.push_back(dividend[0]);
-                exact_remainder.exponent = 1;
-                exact_divisor.digits = divisor;
-                exact_divisor.exponent = 1;
-
-                auto next_digit = 1;
-
-                if (dividend[0] < divisor[0]) {
-                    exact_remainder.digits.push_back(dividend[next_digit]);
-                    exact_remainder.exponent = 2;
-                    next_digit++;
+                const T rem = divide_by_digit_in_place(quotient.data(), quotient.size(), divisor[0], base);
+                if (quotient.size() > 1 && quotient[0] == 0) {
+                    quotient.erase(quotient.begin());
                 }
+                remainder.assign(1, rem);
+            }
 
-                exact_number<T> temp_quotient, temp_remainder, zero;
-                zero.digits = {0};
+            /**
+             *  @brief:  NEWTON DIVISION: computes the quotient of dividend by divisor from a reciprocal of the
+             *           divisor. The reciprocal is seeded from a double and every Newton step doubles its
+             *           precision, so the steps before the last one cost a geometric fraction of it and the
+             *           whole division is O(M(n)). The approximate quotient is off by a few units at most and
+             *           is corrected with a remainder computed over the low limbs of the product only.
+             *           Valid only for integers, with a divisor of two digits or more.
+             *  @param:  dividend - vector to be divided, without leading zeros
+             *  @param:  divisor  - vector which divides, without leading zeros
+             *  @param:  quotient - vector in which the quotient is returned, without leading zeros
+             *  @param:  base     - base of the vectors, at least 6
+             *  @return: true if the division is exact
+             */
+            static bool newton_division(
+                    const std::vector<T>& dividend,
+                    const std::vector<T>& divisor,
+                    std::vector<T>& quotient,
+                    T base = limb_traits<T>::base){
 
-                // looping over the digits of dividend vector
-                while (next_digit <= dividend_size) {
+                const T max_digit = base - 1;
 
-                    T left = 1, right = base - 1, mid = (right - left) / 2 + left;
+                if (dividend.size() < divisor.size()) {
+                    quotient.clear();
+                    return false;
+                }
 
-                    // Binary search to obtain single quotient digit. loop runs less
-                    // than log(base) number of times
+                // a single scaling by a power of two brings the leading digit of the divisor to [base / 4, base),
+                // (divisor[0] + 1) * factor <= base keeps the carry of the lower digits out of the scaled divisor
+                T factor = 1;
+                while ((divisor[0] + 1) * factor <= base / 2) {
+                    factor *= 2;
+                }
+                std::vector<T> a(dividend.size() + 1), b(divisor);
+                std::copy(dividend.begin(), dividend.end(), a.begin() + 1);
+                a[0] = multiply_by_small_in_place(a.data() + 1, dividend.size(), factor, base);
+                multiply_by_small_in_place(b.data(), b.size(), factor, base);
 
-                    while (left <= right) {
-                        mid = (right - left) / 2 + left;
-                        temp_quotient.digits = {mid};
-                        temp_quotient.exponent = 1;
-                        temp_remainder = exact_remainder;
-                        temp_quotient.multiply_vector(exact_divisor, base);
+                const size_t m = b.size();
+                const size_t na = a.size();
+                const size_t quotient_size = na - m + 1;
 
-                        if (temp_quotient > temp_remainder) {
-                            right = mid - 1;
-                        } else if (temp_quotient == temp_remainder) {
-                            temp_remainder = zero;
-                            break;
-                        } else {
-                            temp_remainder.subtract_vector(temp_quotient, base - 1);
-                            if (temp_remainder < exact_divisor) {
-                                break;
-                            } else if (temp_remainder == exact_divisor) {
-                                mid++;
-                                temp_remainder = zero;
-                                break;
-                            } else {
-                                left = mid + 1;
-                            }
-                        }
+                auto truncate = [](exact_number<T> &number, size_t fractional_digits) {
+                    while (!number.digits.empty() &&
+                           (long long) number.digits.size() - number.exponent > (long long) fractional_digits) {
+                        number.digits.pop_back();
+                    }
+                    if (number.digits.empty()) {
+                        number = exact_number<T> ();
                     }
-                    quotient.push_back(mid);
+                };
+
+                /* the reciprocal x of d = 0.b, which lies in [1/4, 1), so x lies in (1, 4] */
+                const double digit_bits = std::log2((double) base);
+                double leading = ((double) b[0] + ((double) b[1] + (m > 2 ? (double) b[2] : 0.0) / base) / base) / base;
+                double seed = 1.0 / leading;
+                T integer_part = (T) seed;
+                double fraction = (seed - integer_part) * base;
+                T first = std::min((T) fraction, max_digit);
+                T second = std::min((T) ((fraction - first) * base), max_digit);
+                exact_number<T> x(std::vector<T> {integer_part, first, second}, 1, true);
+                x.normalize();
+
+                /* precisions in bits of the Newton steps, each about twice the previous one */
+                const double seed_bits = std::min(45.0, 2 * digit_bits - 1);
+                std::vector<double> steps;
+                for (double bits = (quotient_size + 3) * digit_bits; bits > seed_bits; bits = std::ceil(bits / 2) + 2) {
+                    steps.push_back(bits);
+                }
+
+                exact_number<T> one(std::vector<T> {1}, 1, true);
+                for (auto it = steps.rbegin(); it != steps.rend(); ++it) {
+                    size_t fractional_digits = (size_t) std::ceil(*it / digit_bits) + 1;
+
+                    // x + x * (1 - d * x), with d truncated to the precision of this step and both products
+                    // cut to the digits the step keeps: d * x lies close to 1, and x * (1 - d * x) starts as
+                    // many digits after the point as the error has leading zeros
+                    exact_number<T> d(std::vector<T> (b.begin(), b.begin() + std::min(m, fractional_digits + 1)), 0, true);
+                    d.normalize();
+                    exact_number<T> error = one - multiply_truncated(d, x, fractional_digits + 2, false);
+                    truncate(error, fractional_digits + 1);
+                    const long long correction_digits = (long long) fractional_digits + 2 + error.exponent;
+                    if (!error.is_zero() && correction_digits > 0) {
+                        x += multiply_truncated(x, error, (size_t) correction_digits, false);
+                    }
+                    truncate(x, fractional_digits + 1);
+                }
 
-                    exact_remainder = temp_remainder;
-                    if (exact_remainder == zero) {
-                        if (next_digit < dividend_size) {
-                            exact_remainder.digits.clear();
-                            while (dividend[next_digit] == 0 && next_digit < dividend_size) {
-                                quotient.push_back(0); next_digit++;
-                            }
-                            if (next_digit == dividend_size) {
-                                break;
-                            }
-                            exact_remainder.digits.push_back(dividend[next_digit]);
-                            exact_remainder.exponent = 1;
-                            next_digit++;
-                        } else {
-                            break;
-                        }
-                        if (exact_remainder < exact_divisor) {
-                            quotient.push_back(0);
-                            if (next_digit < dividend_size) {
-                                exact_remainder.digits.push_back(dividend[next_digit]);
-                                exact_remainder.exponent = 2;
-                                next_digit++;
-                            } else {
-                                break;
-                            }
+                /* the quotient is a * x scaled by base^(na - m), only its integer part is kept */
+                exact_number<T> product(std::vector<T> (a.begin(), a.begin() + std::min(na, quotient_size + 3)), 0, true);
+                product.normalize();
+                product *= x;
+                product.exponent += (int) (na - m);
+
+                std::vector<T> q(quotient_size + 1, 0);
+                if (product.positive && product.digits.front() != 0) {
+                    for (size_t i = 0; i < product.digits.size() && (long long) i < product.exponent; ++i) {
+                        long long position = (long long) q.size() - product.exponent + (long long) i;
+                        if (position >= 0) {
+                            q[position] = product.digits[i];
                         }
-                    } else if (next_digit < dividend_size) {
-                        exact_remainder.digits.push_back(dividend[next_digit]);
-                        exact_remainder.exponent = 2;
-                        next_digit++;
-                    } else {
-                        break;
                     }
                 }
-                remainder = exact_remainder.digits;
+
+                /* correction: the remainder a - q * b is lower than a few b in magnitude, so it is known
+                 * from the low m + 1 digits of a and q * b, read as a two's complement in base^(m + 1) */
+                const size_t low = m + 1;
+                auto low_digits = [low](const std::vector<T> &v) {
+                    std::vector<T> result(low, 0);
+                    size_t count = std::min(low, v.size());
+                    std::copy(v.end() - count, v.end(), result.end() - count);
+                    return result;
+                };
+                std::vector<T> r = low_digits(a);
+                std::vector<T> q_low = low_digits(q);
+                std::vector<T> b_low = low_digits(b);
+                std::vector<T> low_product(2 * low);
+                multiply_spans(low_product.data(), q_low.data(), low, b_low.data(), low, base);
+                subtract_in_place(r.data(), low_product.data() + low, low, max_digit);
+
+                while (r[0] >= base / 2) {
+                    propagate_borrow(q.data(), q.size(), 1, max_digit);
+                    add_in_place(r.data(), b_low.data(), low, max_digit);
+                }
+                while (compare_spans(r.data(), low, b_low.data(), low) >= 0) {
+                    propagate_carry(q.data(), q.size(), 1, max_digit);
+                    subtract_in_place(r.data(), b_low.data(), low, max_digit);
+                }
+
+                auto leading_zeros = std::find_if(q.begin(), q.end(), [](T digit) { return digit != 0; });
+                quotient.assign(leading_zeros, q.end());
+                return std::all_of(r.begin(), r.end(), [](T digit) { return digit == 0; });
             }
 
             /**
@@ -866,8 +1960,7 @@ namespace boost {
                 }
 
                 static const exact_number<T> zero = exact_number<T> ();
-                static exact_number<T> one_exact("1");
-                static exact_number<T> two_exact("2");
+                static const exact_number<T> one_exact(1);
                 if (divisor == zero) {
                     throw divide_by_zero();
                 }
@@ -889,9 +1982,7 @@ namespace boost {
                     return;
                 }
 
-                static const T base = (std::numeric_limits<T>::max() / 4) * 2 - 1;
-                exact_number<T> half;
-                half.digits = {base / 2 + 1};
+                static const T base = limb_traits<T>::max_digit;
 
                 exact_number<T> numerator, denominator;
                 numerator = (*this).abs();
@@ -918,7 +2009,8 @@ namespace boost {
                     right = one_exact;
                 }
 
-                exact_number<T> length = (right - left) * half;   /* length is half the length of [left, right] */
+                exact_number<T> length = right - left;
+                length.scale_by_power_of_two(-1);   /* length is half the length of [left, right] */
                 (*this) = length + left;
 
                 exact_number<T> residual = (*this) * denominator - numerator;
@@ -946,8 +2038,7 @@ namespace boost {
                         left = (*this);
                     }
 
-                    length = length * half;
-                    length.normalize();
+                    length.scale_by_power_of_two(-1);
                     while (length.digits.size() > max_error_exponent + 1) {
                         length.digits.pop_back();
                     }
@@ -983,7 +2074,10 @@ namespace boost {
             }
 
             /**
-             * @brief:   calculates (*this)/divisor
+             * @brief:   calculates (*this)/divisor, as the integer quotient of the digits scaled to
+             *           max_error_exponent digits after the point. Divisors shorter than
+             *           threshold_set::newton_division digits go through knuth_division, longer ones through
+             *           newton_division.
              * @param:   divisor: an exact_number which divides (*this)
              * @param:   max_error_exponent: Absolute Error in the result should be < 1*base^(-max_error_exponent)
              * @param:   upper: if upper is  
@@ -1003,8 +2097,7 @@ namespace boost {
                 }
 
                 static const exact_number<T> zero = exact_number<T> ();
-                static exact_number<T> one_exact("1");
-                static exact_number<T> two_exact("2");
+                static const exact_number<T> one_exact(1);
                 if (divisor == zero) {
                     throw divide_by_zero();
                 }
@@ -1029,116 +2122,53 @@ namespace boost {
 
                 /* special cases end */
 
-                /* preprocessing required for the newton raphson algorithm to converge 
-                 * divisor should satisfy condition: 0.5 <= divisor <= 1 (in decimal system) */
                 exact_number<T> numerator, denominator;
                 numerator = (*this).abs();
                 denominator = divisor.abs();
+                numerator.normalize();
+                denominator.normalize();
 
                 int exponent_diff = numerator.exponent - denominator.exponent;
-                numerator.exponent = 0;
-                denominator.exponent = 0;
-
-                const T base = (std::numeric_limits<T>::max() / 4) * 2;
-
-                while (denominator.digits[0] < base / 2) {
-                    denominator = denominator * two_exact;
-                    numerator = numerator * two_exact;
-                }
-                /* preprocessing end */
-
-                /* Reciprocal computation starts */
-                /* initializing the reciprocal guess */
-                /* initial guess for the reciprocal is (48 - 32*divisor)/17 */
-                exact_number<T> reciprocal, more_precise_reciprocal;
-                exact_number<T> _32(std::vector<T> {32}, 1, true);
-                exact_number<T> _48(std::vector<T> {48}, 1, true);
-                exact_number<T> _17(std::vector<T> {17}, 1, true);
-
-                reciprocal = _48 - _32*denominator;
-                reciprocal.binary_search_division(_17, max_error_exponent); /* approximate division method */
-                /* Initial guess end*/
-
-                --max_error_exponent; 
-                exact_number<T> error, residual, answer, more_precise_answer;
-                answer = reciprocal * numerator;
-
-                exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-
-                /* newton raphson iteration starts */
-                do {
-                    /* improving guess */
-                    reciprocal = reciprocal * ( two_exact - reciprocal*denominator);
-                    reciprocal.normalize();
-
-                    /* truncate insignificant digits from the reciprocal */
-                    while ((int) reciprocal.digits.size() - reciprocal.exponent - numerator.exponent >  max_error_exponent + 1) {
-                        reciprocal.digits.pop_back();
-                    }
-
-                    more_precise_answer = reciprocal * numerator;
-                    more_precise_answer.normalize();
 
-                    /* truncate insignificant digits from the reciprocal */
-                    while ((int) more_precise_answer.digits.size() - more_precise_answer.exponent > max_error_exponent + 1) {
-                        more_precise_answer.digits.pop_back();
-                    }
-
-                    /* if there is no improvement then exit */
-                    if (more_precise_answer == answer) {
-                        break;
-                    }
-
-                    /* Compute the improvement in result */
-                    error = more_precise_answer - answer;
-                    error = error.abs();
-
-                    answer = more_precise_answer;
-                    
-                } while (error > max_error);
-                /* newton raphson iteration ends*/
-
-                (*this) = answer;
-                
-                residual = (*this) * denominator - numerator;
-                residual.normalize();
-
-                if (upper) {/* residual shoud be positive or = zero */
-
-                    if (residual < zero) {/* if residual is negative, we make it positive or = zero */
-                        (*this) += max_error;
-                    }
-
-                    if (residual > zero) {/* if residual is positive, we check if we can make it zero */
-                        exact_number<T> tmp_lower = (*this) - max_error;
-                        residual = tmp_lower * denominator - numerator;
-                        residual.normalize();
-                        if (residual == zero) {
-                            (*this) = tmp_lower;
-                        }
-                    }
+                const T base = limb_traits<T>::base;
 
-                } else {/* residual shoud be negative = zero */
+                /* with both numbers scaled to exponent 0, the result truncated to max_error_exponent digits
+                 * after the point is the integer quotient of numerator * base^shift by denominator */
+                const digits_type &n = numerator.digits;
+                const std::vector<T> d = denominator.digits;
+                long long shift = (long long) max_error_exponent + (long long) d.size() - (long long) n.size();
 
-                    if (residual > zero) {/* if residual is positive, we make it negative or = zero */
-                        (*this) -= max_error;
-                    }
+                std::vector<T> dividend;
+                bool dropped_digits = false; /* whether non zero digits of the numerator were cut by a negative shift */
+                if (shift >= 0) {
+                    dividend.reserve(n.size() + shift);
+                    dividend.assign(n.begin(), n.end());
+                    dividend.resize(n.size() + shift, 0);
+                } else {
+                    dividend.assign(n.begin(), n.end() + shift);
+                    dropped_digits = std::any_of(n.end() + shift, n.end(), [](T digit) { return digit != 0; });
+                }
 
-                    if (residual < zero) {/* if residual is negative, we check if we can make it zero */
-                        exact_number<T> tmp_upper = (*this) + max_error;
-                        residual = tmp_upper * denominator - numerator;
-                        residual.normalize();
+                std::vector<T> quotient, remainder;
+                bool exact;
+                if ((int) d.size() < algorithm_thresholds<T>::get().newton_division) {
+                    knuth_division(dividend, d, quotient, remainder, base);
+                    exact = std::all_of(remainder.begin(), remainder.end(), [](T digit) { return digit == 0; });
+                } else {
+                    exact = newton_division(dividend, d, quotient, base);
+                }
+                exact = exact && !dropped_digits;
 
-                        if (residual == zero) {
-                            (*this) = tmp_upper;
-                        }
-                    }
+                /* the truncated quotient has a [-epsilon, 0] error, one more unit in the last place moves it to [0, epsilon] */
+                quotient.insert(quotient.begin(), 0);
+                if (upper && !exact) {
+                    propagate_carry(quotient.data(), quotient.size(), 1, base - 1);
                 }
 
-                this->exponent += exponent_diff;
+                this->digits = std::move(quotient);
+                this->exponent = (int) this->digits.size() - (int) max_error_exponent + exponent_diff;
                 this->positive = positive;
                 this->normalize();
-
             }
 
             /**
@@ -1157,7 +2187,7 @@ namespace boost {
                 number_copy = number;
 
                 /* exponent_vector is vector representation of exponent */
-                std::vector<T> exponent_vector, remainder, quotient;
+                std::vector<T> exponent_vector;
                 exponent_vector = exponent.digits;
 
                 while((int) exponent_vector.size() < exponent.exponent){
@@ -1165,19 +2195,15 @@ namespace boost {
                 }
 
                 while(true){
-                    division_by_single_digit(exponent_vector, std::vector<T> {2}, quotient, remainder);
-                    if ( !(remainder.empty() || ((int)remainder.size() == 1 && remainder[0] == 0)) ) {
+                    if (halve_integer(exponent_vector)) {
                         result = result * number_copy;
                     }
 
                     number_copy = number_copy * number_copy;
 
-                    exponent_vector = quotient;
                     if(((int)exponent_vector.size() == 1 && exponent_vector[0] == 0) || exponent_vector.empty()){
                         break;
                     }
-                    quotient.clear();
-                    remainder.clear();
                 }
 
                 return result;
@@ -1249,23 +2275,132 @@ namespace boost {
 
             exact_number<T>(std::vector<T> vec, bool pos = true) : digits(vec), exponent(vec.size()), positive(pos) {};
 
-            /// ctor from any integral type
-            /// @TODO: use whichever base.
-            // template<typename I, typename std::enable_if_t<std::is_integral<I>::value>>
-            // exact_number(I x) {
-                // if (x < 0)
-                    // positive = false;
-                // else
-                    // positive = true;
-                
-                // exponent = 0;
-                // while (((x % BASE) != 0) || (x != 0)) {
-                    // exponent++;
-                    // push_front(std::abs(x%BASE));
-                    // x /= BASE;
-                // }
-            // }
-        
+            /// ctor from a limb list, most significant limb first, and the exponent of the first limb
+            exact_number<T>(std::initializer_list<T> limbs, exponent_t exp, bool pos = true) : digits(limbs), exponent(exp), positive(pos) {};
+
+            /// ctor from any integral type, split in limbs of the base without going through a string
+            template <typename I, typename std::enable_if_t<std::is_integral<I>::value && !std::is_same<I, bool>::value, int> = 0>
+            constexpr explicit exact_number(I x) {
+                using magnitude_t = unsigned long long;
+                const magnitude_t base = (magnitude_t) limb_traits<T>::base;
+                positive = !(x < 0);
+                magnitude_t magnitude = positive ? (magnitude_t) x : (magnitude_t) 0 - (magnitude_t) x;
+
+                if (magnitude == 0) {
+                    digits = {0};
+                    return;
+                }
+                while (magnitude != 0) {
+                    exponent++;
+                    this->push_front((T) (magnitude % base));
+                    magnitude /= base;
+                }
+                this->normalize();
+            }
+
+            /**
+             *  @brief: the limbs of blocks[0..count), digits of the base block, most significant first. A long run
+             *          is its upper part times the power of block from powers over its lower 2^level blocks,
+             *          plus that lower part, a short one is summed by Horner's rule.
+             *  @param: powers: powers[i] = block^(2^i), in limbs
+             */
+            static std::vector<T> limbs_from_blocks(const T* blocks, size_t count, T block, const std::vector<std::vector<T>> &powers, T base) {
+                if (count <= (size_t) algorithm_thresholds<T>::get().karatsuba_base_case) {
+                    // every block is below the base, so count limbs hold the value
+                    std::vector<T> result(count, 0);
+                    for (size_t i = 0; i < count; ++i) {
+                        multiply_by_small_in_place(result.data(), count, block, base);
+                        add_digit_in_place(result.data(), count, blocks[i], base - 1);
+                    }
+                    return result;
+                }
+
+                size_t level = 0;
+                while (((size_t) 2 << level) < count) {
+                    ++level;
+                }
+                const size_t low_count = (size_t) 1 << level;
+                std::vector<T> high = limbs_from_blocks(blocks, count - low_count, block, powers, base);
+                std::vector<T> low = limbs_from_blocks(blocks + count - low_count, low_count, block, powers, base);
+                auto is_not_zero = [](T digit) { return digit != 0; };
+                high.erase(high.begin(), std::find_if(high.begin(), high.end() - 1, is_not_zero));
+                low.erase(low.begin(), std::find_if(low.begin(), low.end(), is_not_zero));
+
+                const std::vector<T> &power = powers[level];
+                std::vector<T> result(high.size() + power.size());
+                multiply_spans(result.data(), high.data(), high.size(), power.data(), power.size(), base);
+                // low < power, so it fits in the limbs of the product below its top
+                const size_t offset = result.size() - low.size();
+                const T carry = add_in_place(result.data() + offset, low.data(), low.size(), base - 1);
+                add_digit_in_place(result.data(), offset, carry, base - 1);
+                return result;
+            }
+
+            /**
+             *  @brief: DECIMAL TO LIMBS: the limbs, most significant first and without leading zeros, of the
+             *          integer written by the decimal digits. The digits are read in blocks of the largest
+             *          power of ten below the base, one limb each, and the blocks are combined by halves with
+             *          a table of the squares of that power, so the conversion costs O(M(n) log n) with the
+             *          products of multiply_vector, instead of a long division by the base per limb.
+             *  @param: digits: the characters '0' to '9', most significant first
+             *  @param: base: the base of the limbs
+             */
+            static std::vector<T> limbs_from_decimal(std::string_view digits, T base = limb_traits<T>::base) {
+                int block_digits = 1;
+                T block = 10;
+                while (block <= (base - 1) / 10) {
+                    block *= 10;
+                    ++block_digits;
+                }
+
+                // the first block takes the digits left over by the others
+                const size_t count = (digits.size() + block_digits - 1) / block_digits;
+                std::vector<T> blocks(count, 0);
+                size_t end = digits.size();
+                for (size_t i = count; i-- > 0;) {
+                    const size_t begin = end > (size_t) block_digits ? end - block_digits : 0;
+                    for (size_t j = begin; j < end; ++j) {
+                        blocks[i] = blocks[i] * 10 + (T) (digits[j] - '0');
+                    }
+                    end = begin;
+                }
+
+                std::vector<std::vector<T>> powers = {{block}};
+                while (((size_t) 1 << powers.size()) < count) {
+                    const std::vector<T> &last = powers.back();
+                    std::vector<T> square(2 * last.size());
+                    multiply_spans(square.data(), last.data(), last.size(), last.data(), last.size(), base);
+                    square.erase(square.begin(), std::find_if(square.begin(), square.end(), [](T digit) { return digit != 0; }));
+                    powers.push_back(std::move(square));
+                }
+
+                std::vector<T> result = limbs_from_blocks(blocks.data(), count, block, powers, base);
+                result.erase(result.begin(), std::find_if(result.begin(), result.end(), [](T digit) { return digit != 0; }));
+                if (result.empty()) {
+                    result.push_back(0);
+                }
+                return result;
+            }
+
+            /**
+             *  @brief: the integer whose decimal digits are integer_part and decimal_part, with zeros after them up
+             *          to exponent digits, as number_from_string gives it, in normalized limbs of the base
+             */
+            static exact_number<T> integer_from_decimal(std::string_view integer_part, std::string_view decimal_part, int exponent, bool positive) {
+                std::string digits;
+                digits.reserve(std::max((size_t) std::max(exponent, 0), integer_part.size() + decimal_part.size()));
+                digits.append(integer_part).append(decimal_part);
+                if (exponent > (int) digits.size()) {
+                    digits.append(exponent - digits.size(), '0');
+                }
+
+                const std::vector<T> limbs = limbs_from_decimal(digits);
+                exact_number<T> result(limbs, (exponent_t) limbs.size(), positive);
+                // the zero limbs at the end go into the exponent
+                result.normalize();
+                return result;
+            }
+
             // returns {integer_part, decimal_part, exponent, is_positive}
             constexpr static std::tuple<std::string_view, std::string_view, exponent_t, bool> number_from_string(std::string_view number) {
                 std::string_view integer_part;
@@ -1448,7 +2583,8 @@ namespace boost {
              */
             exact_number<T>(const exact_number<T> &other) = default;
 
-            /// TODO: move ctor
+            /// move ctor, it takes the digits of other, a heap buffer is not copied
+            exact_number<T>(exact_number<T> &&other) noexcept = default;
 
             /**
              * @brief Default asignment operator.
@@ -1457,6 +2593,27 @@ namespace boost {
              */
             exact_number<T> &operator=(const exact_number<T>& other) = default;
 
+            exact_number<T> &operator=(exact_number<T>&& other) noexcept = default;
+
+            /// whether the number is zero, which has the digits {0} or none
+            bool is_zero() const {
+                return this->digits.empty() || (this->digits.size() == 1 && this->digits.front() == 0);
+            }
+
+            /// compares |lhs| < |rhs| without copying either number
+            static bool abs_is_lower(const exact_number<T> &lhs, const exact_number<T> &rhs) {
+                if (lhs.is_zero()) {
+                    return !rhs.is_zero();
+                }
+                if (rhs.is_zero()) {
+                    return false;
+                }
+                if (lhs.exponent == rhs.exponent) {
+                    return aligned_vectors_is_lower(lhs.digits, rhs.digits);
+                }
+                return lhs.exponent < rhs.exponent;
+            }
+
             /**
              * @brief *Lower comparator operator:* It compares the *this boost::real::exact_number with the other
              * boost::real::exact_number to determine if *this is lower than other.
@@ -1465,11 +2622,10 @@ namespace boost {
              * @return a bool that is true if and only if *this is lower than other.
              */
             bool operator<(const exact_number& other) const {
-                std::vector<T> zero = {0};
-                if (this->digits == zero || this->digits.empty()) {
-                    return !(other.digits == zero || !other.positive || other.digits.empty());
+                if (this->is_zero()) {
+                    return !(other.is_zero() || !other.positive);
                 } else {
-                    if ((other.digits == zero || other.digits.empty()))
+                    if (other.is_zero())
                         return !this->positive;
                 }
                 if (this->positive != other.positive) {
@@ -1499,11 +2655,10 @@ namespace boost {
              * @return a bool that is true if and only if *this is greater than other.
              */
             bool operator>(const exact_number& other) const {
-                std::vector<T> zero = {0};
-                if (this->digits == zero || this->digits.empty()) {
-                    return !(other.digits == zero || other.positive || other.digits.empty());
+                if (this->is_zero()) {
+                    return !(other.is_zero() || other.positive);
                 } else {
-                    if ((other.digits == zero) && this->positive)
+                    if ((other.digits.size() == 1 && other.digits.front() == 0) && this->positive)
                         return true;
                 } 
                 if (this->positive != other.positive) {
@@ -1554,26 +2709,37 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator+(exact_number<T> other) {
-                exact_number<T> result;
-
-                if (this->positive == other.positive) {
-                        result = *this;
-                        result.add_vector(other);
-                } else if (other.abs() < this->abs()) {
-                        result = *this;
-                        result.subtract_vector(other);
-                        result.positive = this->positive;
-                } else {
-                    result = other;
+            exact_number<T> operator+(const exact_number<T> &other) const & {
+                if (this->positive != other.positive && abs_is_lower(*this, other)) {
+                    exact_number<T> result = other;
                     result.subtract_vector(*this);
                     result.positive = !this->positive;
+                    return result;
                 }
+                exact_number<T> result = *this;
+                result += other;
                 return result;
             }
 
-            void operator+=(exact_number<T> &other) {
-                *this = *this + other;
+            /// a temporary left operand holds the sum, so no copy is made
+            exact_number<T> operator+(const exact_number<T> &other) && {
+                *this += other;
+                return std::move(*this);
+            }
+
+            /// adds other to *this in place, only a larger other of the opposite sign is copied
+            exact_number<T> &operator+=(const exact_number<T> &other) {
+                if (this->positive == other.positive) {
+                    this->add_vector(other);
+                } else if (abs_is_lower(other, *this)) {
+                    this->subtract_vector(other);
+                } else {
+                    exact_number<T> result = other;
+                    result.subtract_vector(*this);
+                    result.positive = !this->positive;
+                    *this = std::move(result);
+                }
+                return *this;
             }
 
             //Add exact numbers assuming base 10
@@ -1596,30 +2762,37 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator-(exact_number<T> other) {
-                exact_number<T> result;
-
-                if (this->positive != other.positive) {
-                    result = *this;
-                    result.add_vector(other);
-                    result.positive = this->positive;
-                } else {
-                    if (other.abs() < this->abs()) {
-                        result = *this;
-                        result.subtract_vector(other);
-                        result.positive = this->positive;
-                    } else {
-                        result = other;
-                        result.subtract_vector(*this);
-                        result.positive = !this->positive;
-                    }
+            exact_number<T> operator-(const exact_number<T> &other) const & {
+                if (this->positive == other.positive && !abs_is_lower(other, *this)) {
+                    exact_number<T> result = other;
+                    result.subtract_vector(*this);
+                    result.positive = !this->positive;
+                    return result;
                 }
-
+                exact_number<T> result = *this;
+                result -= other;
                 return result;
             }
 
-            void operator-=(exact_number<T> &other) {
-                *this = *this - other;
+            /// a temporary left operand holds the difference, so no copy is made
+            exact_number<T> operator-(const exact_number<T> &other) && {
+                *this -= other;
+                return std::move(*this);
+            }
+
+            /// subtracts other from *this in place, only a larger other of the same sign is copied
+            exact_number<T> &operator-=(const exact_number<T> &other) {
+                if (this->positive != other.positive) {
+                    this->add_vector(other);
+                } else if (abs_is_lower(other, *this)) {
+                    this->subtract_vector(other);
+                } else {
+                    exact_number<T> result = other;
+                    result.subtract_vector(*this);
+                    result.positive = !this->positive;
+                    *this = std::move(result);
+                }
+                return *this;
             }
 
             //Subtract exact numbers assuming base 10
@@ -1645,15 +2818,32 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator*(exact_number<T> other) {
+            exact_number<T> operator*(const exact_number<T> &other) const & {
                 exact_number<T> result = *this;
-                result.multiply_vector(other);
-                result.positive = (this->positive == other.positive);
+                if (this == &other) {
+                    // x * x takes the squaring kernels
+                    result.square();
+                } else {
+                    result *= other;
+                }
                 return result;
             }
 
-            void operator*=(exact_number<T> &other) {
-                *this = *this * other;
+            /// a temporary left operand holds the product, so no copy is made
+            exact_number<T> operator*(const exact_number<T> &other) && {
+                *this *= other;
+                return std::move(*this);
+            }
+
+            exact_number<T> &operator*=(const exact_number<T> &other) {
+                if (this == &other) {
+                    this->square();
+                } else {
+                    const bool positive = (this->positive == other.positive);
+                    this->multiply_vector(other);
+                    this->positive = positive;
+                }
+                return *this;
             }
 
             //Multiply exact numbers assuming base 10
@@ -1746,7 +2936,7 @@ namespace boost {
                 std::reverse (decimal.begin(), decimal.end()); 
 
                 //integer and decimal are string vectors with the "digits" in diff base
-                T b = (std::numeric_limits<T>::max() /4)*2;
+                T b = limb_traits<T>::base;
                 std::vector<T> base;
                 while (b!=0) {
                     base.push_back(b%10);
@@ -1876,6 +3066,7 @@ namespace boost {
              * @param digit - The new digit to add.
              */
             void push_front(T digit) {
+                // constant time with the small buffer storage, it reuses the room left by trimmed leading zeros
                 this->digits.insert(this->digits.cbegin(), digit);
             }
 
@@ -1884,10 +3075,7 @@ namespace boost {
              * normalized representation.
              */
             void normalize() {
-                while (this->digits.size() > 1 && this->digits.front() == 0) {
-                    this->digits.erase(this->digits.cbegin());
-                    this->exponent--;
-                }
+                this->normalize_left();
 
                 while (this->digits.size() > 1 && this->digits.back() == 0) {
                     this->digits.pop_back();
@@ -1905,9 +3093,15 @@ namespace boost {
              * into a semi normalized representation.
              */
             void normalize_left() {
-                while (this->digits.size() > 1 && this->digits.front() == 0) {
-                    this->digits.erase(this->digits.cbegin());
-                    this->exponent--;
+                // leading zeros are counted first and erased at once, the small buffer storage drops them
+                // by moving its start
+                size_t leading_zeros = 0;
+                while (leading_zeros + 1 < this->digits.size() && this->digits[leading_zeros] == 0) {
+                    ++leading_zeros;
+                }
+                if (leading_zeros > 0) {
+                    this->digits.erase(this->digits.cbegin(), this->digits.cbegin() + leading_zeros);
+                    this->exponent -= (int)leading_zeros;
                 }
             }
 
@@ -1939,12 +3133,15 @@ namespace boost {
 
             /// returns an exact_number that has the precision given
             exact_number<T> up_to(size_t precision, bool upper) {
-                T base = (std::numeric_limits<T>::max() /4)*2 - 1;
+                T base = limb_traits<T>::max_digit;
                 if (precision >= digits.size())
                     return *this;
 
-                exact_number<T> ret = *this;
-                ret.digits = std::vector<T>(digits.begin(), digits.begin() + precision);
+                // only the kept prefix is copied
+                exact_number<T> ret;
+                ret.digits.assign(digits.begin(), digits.begin() + precision);
+                ret.exponent = exponent;
+                ret.positive = positive;
 
                 bool round = (precision < digits.size());
                 if (round) {
@@ -1969,37 +3166,224 @@ namespace boost {
 
         };
 
+        /**
+         *  @brief: a bound of a * b with at most precision digits, computed from the top digits of the
+         *          operands only. The product's top precision + 2 digits come from the short product
+         *          multiply_high_basecase, or from a full product of the operands cut to that length once
+         *          they are long enough for karatsuba_multiplication, and the error of either is bounded.
+         *          The result is then rounded towards the requested side, so it is a rigorous lower
+         *          (round_up false) or upper (round_up true) bound, within a few units of its last digit.
+         *
+         *          It costs O(precision^2), or M(precision), whatever the length of the operands.
+         */
+        template <typename T>
+        exact_number<T> multiply_truncated(const exact_number<T> &a, const exact_number<T> &b, size_t precision, bool round_up) {
+            const T base = limb_traits<T>::base;
+            const T max_digit = base - 1;
+            const bool positive = (a.positive == b.positive);
+            if (a.is_zero() || b.is_zero() || precision == 0) {
+                return exact_number<T>();
+            }
+
+            // leading zeros are skipped, the product then starts on its first or second digit
+            const T* a_digits = a.digits.data();
+            const T* b_digits = b.digits.data();
+            size_t na = a.digits.size(), nb = b.digits.size();
+            int exponent = a.exponent + b.exponent;
+            for (; na > 0 && *a_digits == 0; ++a_digits, --na, --exponent) {}
+            for (; nb > 0 && *b_digits == 0; ++b_digits, --nb, --exponent) {}
+            if (na == 0 || nb == 0) {
+                return exact_number<T>();
+            }
+
+            const size_t k = precision + 2;
+            // the product is exact when no limb product is dropped
+            const bool exact = (na + nb <= k + 1);
+            exact_number<T> result;
+            result.digits.resize(k + 1);
+            // units of r[k - 1] the magnitude of the product may be above r[0..k]
+            T error = 0;
+
+            if (std::min(std::min(na, nb), k) < (size_t) algorithm_thresholds<T>::get().karatsuba_base_case) {
+                exact_number<T>::multiply_high_basecase(result.digits.data(), a_digits, na, b_digits, nb, k, base);
+                if (!exact) {
+                    error = (T) (2 * std::min(na, nb));
+                }
+            } else {
+                // the operands cut to k digits are each less than one unit of their k-th digit below the
+                // full ones, which moves the product by less than 2 units of r[k - 1], and the digits of
+                // the product after r[k] add less than one more
+                const size_t la = std::min(na, k), lb = std::min(nb, k);
+                exact_number<T> product, rhs;
+                product.digits.assign(a_digits, a_digits + la);
+                rhs.digits.assign(b_digits, b_digits + lb);
+                product.exponent = (int) la;
+                rhs.exponent = (int) lb;
+                product.multiply_vector(rhs);
+
+                // multiply_vector normalizes the la + lb digits of the product, its exponent tells how many
+                // of them it dropped in front
+                const size_t leading = la + lb - (size_t) product.exponent;
+                std::fill(result.digits.begin(), result.digits.end(), 0);
+                for (size_t i = 0; i < product.digits.size() && leading + i <= k; ++i) {
+                    result.digits[leading + i] = product.digits[i];
+                }
+                if (!exact) {
+                    error = 3;
+                }
+            }
+            result.exponent = exponent;
+            result.positive = positive;
+
+            // the bound on the magnitude's side the rounding goes to
+            const bool magnitude_up = (round_up == positive);
+            if (magnitude_up && error != 0) {
+                T &digit = result.digits[k - 1];
+                if (digit > max_digit - error) {
+                    digit -= base - error;
+                    exact_number<T>::propagate_carry(result.digits.data(), k - 1, 1, max_digit);
+                } else {
+                    digit += error;
+                }
+            }
+            result.normalize();
+
+            if (result.digits.size() > precision) {
+                const bool inexact = std::any_of(result.digits.begin() + precision, result.digits.end(), [](T digit) { return digit != 0; });
+                result.digits.resize(precision);
+                if (magnitude_up && inexact) {
+                    result.round_up_abs(max_digit);
+                }
+                result.normalize();
+            }
+            return result;
+        }
+
+        /**
+         *  @brief: fused multiply-add, acc += a * b, accumulated in place into the digits of acc, widened
+         *          to cover the product. Operands shorter than the karatsuba threshold add their schoolbook
+         *          rows straight into acc in a single pass each, longer ones are multiplied once and the
+         *          product is added or subtracted in a single pass.
+         */
+        template <typename T>
+        void fma(exact_number<T> &acc, const exact_number<T> &a, const exact_number<T> &b) {
+            if (a.is_zero() || b.is_zero()) {
+                return;
+            }
+            if (&acc == &a || &acc == &b) {
+                // the digits of acc are widened below, an operand that is acc is read from a copy
+                const exact_number<T> copy = acc;
+                fma(acc, (&acc == &a) ? copy : a, (&acc == &b) ? copy : b);
+                return;
+            }
+            const T base = limb_traits<T>::base;
+            const T max_digit = limb_traits<T>::max_digit;
+            const bool positive = (a.positive == b.positive);
+            if (acc.is_zero()) {
+                acc.positive = positive;
+            }
+            const bool subtract = (acc.positive != positive);
+
+            const size_t na = a.digits.size(), nb = b.digits.size();
+            if (std::min(na, nb) < (size_t) algorithm_thresholds<T>::get().karatsuba_base_case) {
+                // digit i of a times digit j of b lands on digit i + j + 1 of the product
+                const exact_number<T> &longer = (na >= nb) ? a : b;
+                const exact_number<T> &shorter = (na >= nb) ? b : a;
+                const size_t offset = acc.widen_to(a.exponent + b.exponent, na + nb);
+                T *r = acc.digits.data();
+                bool borrowed_out = false;
+                for (size_t j = 0; j < shorter.digits.size(); ++j) {
+                    const T digit = shorter.digits[j];
+                    if (digit == 0) {
+                        continue;
+                    }
+                    T *row = r + offset + j + 1;
+                    if (subtract) {
+                        T borrow = exact_number<T>::subtract_mul_small_in_place(row, longer.digits.data(), longer.digits.size(), digit, base);
+                        borrowed_out |= exact_number<T>::subtract_digit_in_place(r, offset + j + 1, borrow, max_digit) != 0;
+                    } else {
+                        T carry = exact_number<T>::add_mul_small_in_place(row, longer.digits.data(), longer.digits.size(), digit, base);
+                        exact_number<T>::add_digit_in_place(r, offset + j + 1, carry, max_digit);
+                    }
+                }
+                acc.finish_in_place_sum(borrowed_out);
+                return;
+            }
+
+            exact_number<T> product = a;
+            if (&a == &b) {
+                product.square();
+            } else {
+                product *= b;
+            }
+            const size_t offset = acc.widen_to(product.exponent, product.digits.size());
+            T *r = acc.digits.data();
+            bool borrowed_out = false;
+            if (subtract) {
+                T borrow = exact_number<T>::subtract_in_place(r + offset, product.digits.data(), product.digits.size(), max_digit);
+                borrowed_out = exact_number<T>::propagate_borrow(r, offset, borrow, max_digit) != 0;
+            } else {
+                T carry = exact_number<T>::add_in_place(r + offset, product.digits.data(), product.digits.size(), max_digit);
+                exact_number<T>::propagate_carry(r, offset, carry, max_digit);
+            }
+            acc.finish_in_place_sum(borrowed_out);
+        }
+
+        /**
+         *  @brief: acc += a * limb for a single digit 0 <= limb < base, in one pass of
+         *          add_mul_small_in_place (or its subtraction) over the digits of acc that a lands on.
+         */
+        template <typename T>
+        void add_mul_small(exact_number<T> &acc, const exact_number<T> &a, T limb) {
+            if (limb == 0 || a.is_zero()) {
+                return;
+            }
+            if (&acc == &a) {
+                const exact_number<T> copy = a;
+                add_mul_small(acc, copy, limb);
+                return;
+            }
+            const T base = limb_traits<T>::base;
+            const T max_digit = limb_traits<T>::max_digit;
+            if (acc.is_zero()) {
+                acc.positive = a.positive;
+            }
+
+            // a * limb has one more integer digit than a
+            const size_t offset = acc.widen_to(a.exponent + 1, a.digits.size() + 1);
+            T *r = acc.digits.data();
+            bool borrowed_out = false;
+            if (acc.positive != a.positive) {
+                T borrow = exact_number<T>::subtract_mul_small_in_place(r + offset + 1, a.digits.data(), a.digits.size(), limb, base);
+                borrowed_out = exact_number<T>::subtract_digit_in_place(r, offset + 1, borrow, max_digit) != 0;
+            } else {
+                T carry = exact_number<T>::add_mul_small_in_place(r + offset + 1, a.digits.data(), a.digits.size(), limb, base);
+                exact_number<T>::add_digit_in_place(r, offset + 1, carry, max_digit);
+            }
+            acc.finish_in_place_sum(borrowed_out);
+        }
+
 
         namespace literals{
 
             template<typename T>
-            const exact_number<T> minus_one_exact = exact_number<T>("-1");
+            const exact_number<T> minus_one_exact = exact_number<T>(-1);
 
             template<typename T = int>
-            const exact_number<T> zero_exact = exact_number<T>("0");
+            const exact_number<T> zero_exact = exact_number<T>(0);
 
             template<typename T>
-            const exact_number<T> one_exact = exact_number<T>("1");
+            const exact_number<T> one_exact = exact_number<T>(1);
 
             template<typename T>
-            const exact_number<T> two_exact = exact_number<T>("2");
+            const exact_number<T> two_exact = exact_number<T>(2);
 
             template<typename T>
-            const exact_number<T> four_exact = exact_number<T>("4");
+            const exact_number<T> four_exact = exact_number<T>(4);
 
             template<typename T>
-            const exact_number<T> eight_exact = exact_number<T>("8");
-
-        }
-
-        template<> inline int exact_number<int>::mul_mod (int a, int b, int c)
-        {
-            return ((long long)a * (long long)b )%c;
-        }
+            const exact_number<T> eight_exact = exact_number<T>(8);
 
-        template<> inline int exact_number<int>::mult_div(int a, int b, int c)
-        {
-            return ((long long)a * (long long)b)/c;
         }
     }
 }
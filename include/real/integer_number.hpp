@@ -28,7 +28,8 @@ namespace boost{
 		struct integer_number{
 			
 
-			static const T BASE = ((std::numeric_limits<T>::max() / 2) -1);
+			// the base of exact_number limbs as well, the limbs of an integer are those of the exact_number
+			static constexpr T BASE = limb_traits<T>::base;
 			std::vector<T> digits = {};
 			bool positive = true;
 
@@ -36,7 +37,7 @@ namespace boost{
 			// base is not taken as a paramter, because it is already defined up there
 			// this function will not take account into the signs of numbers, it will simply add them
 			// signs will will taken care of when we will define operator overloading for these numbers
-			integer_number<T> add_integer_number(integer_number &other)
+			integer_number<T> add_integer_number(const integer_number &other) const
 			{
 				int carry = 0;
 				T sum = 0;
@@ -79,7 +80,7 @@ namespace boost{
 			 * This function will simply Subtract vector A from B, and A should be bigger than B.
 			 * These conditions will be checked by operator overload and this function will be called in an appropriate manner.
 			 **/
-			integer_number<T> subtract_integer_number(integer_number<T> &other)
+			integer_number<T> subtract_integer_number(const integer_number<T> &other) const
 			{
 				// it is assumed that digits in (*this) are greater than digits in other
 				int borrow = 0;
@@ -123,6 +124,14 @@ namespace boost{
 
 
 
+			// compares the magnitudes of two integers without leading zeros, -1, 0 or 1 as |*this| <, == or > |other|
+			int compare_magnitude(const integer_number<T> &other) const{
+				if(digits.size() != other.digits.size())
+					return digits.size() < other.digits.size() ? -1 : 1;
+				if(digits == other.digits) return 0;
+				return digits < other.digits ? -1 : 1;
+			}
+
 			// overloading operators for integer numbers
 
 			bool operator == (const integer_number<T> other) const{
@@ -170,7 +179,7 @@ namespace boost{
 
 
 			// overloading + operator for integer types
-			integer_number<T> operator + (integer_number<T> other)
+			integer_number<T> operator + (const integer_number<T> &other) const
 			{
 				integer_number<T> result;
 				if(positive == other.positive)  // of both signs are same, then simply add two vectors
@@ -181,7 +190,7 @@ namespace boost{
 				}
 				// now if signs of both numbers are not same
 				else {
-					if((*this).digits > other.digits)
+					if(compare_magnitude(other) > 0)
 					{
 						result = subtract_integer_number(other);
 						if(other.positive == false)
@@ -215,50 +224,28 @@ namespace boost{
 				}
 			}
 
-			// overloading "-" operator 
-			integer_number<T> operator - (integer_number<T> other)
+			// overloading "-" operator, a - b is a + (-b)
+			integer_number<T> operator - (const integer_number<T> &other) const
 			{
-				integer_number<T> result;
-				// if signs of boths numbers are equal
-				if(positive == other.positive)
-				{
-					if(digits >= other.digits)
-					{
-						result = subtract_integer_number(other);
-						result.positive = true;
-						return result;
-					}
-					else 
-					{
-						result = other.subtract_integer_number((*this));
-						result.positive = false;
-						return result;
-					}
-				}
-				else{
-					if(other.positive==false)
-					{
-						result = add_integer_number(other);
-						result.positive = true;
-						return result;
-					}
-					else
-					{
-						result = add_integer_number(other);
-						result.positive = false;
-						return result;
-					}
-				}
+				integer_number<T> negated = other;
+				negated.positive = !other.positive;
+				return (*this) + negated;
 			}
 
-			integer_number<T> operator * (integer_number<T> other){
-				integer_number<T> result;
-				if((*this) == integer_number<T>("0") || other == integer_number<T>("0"))
-					return integer_number<T>("0");
+			// the product is taken by exact_number::multiply_vector, which picks karatsuba, toom-cook or the NTT
+			// from the operand lengths, and squares a number multiplied by itself
+			integer_number<T> operator * (const integer_number<T> &other) const{
+				if((*this) == integer_number<T>(0) || other == integer_number<T>(0))
+					return integer_number<T>(0);
+				exact_number<T> product = to_exact_number();
+				if(this == &other || digits == other.digits)
+					product.square(BASE);
+				else
+					product.multiply_vector(other.to_exact_number(), BASE);
+
 				// if sign of both numbers are same, then number is positive, else negative
-				result.positive = !((*this).positive^other.positive);
-				result.digits = multiply<T>((*this).digits, other.digits, BASE);
-				return result;
+				product.positive = !((*this).positive^other.positive);
+				return integer_number<T>(product);
 			}
 
 			inline void operator *= (integer_number<T> other){
@@ -282,15 +269,15 @@ namespace boost{
 
 
 			integer_number<T> &operator = (const integer_number<T>& other) = default;
-			integer_number<T> operator - (void) {
+			integer_number<T> operator - (void) const{
 				integer_number result = (*this);
 				// if the number is zero, then no change is needed
-				if(result.digits.size() == 1 && result.digits.size() == 0) return result;
+				if(result.digits.size() == 1 && result.digits[0] == 0) return result;
 				result.positive = (!result.positive);
 				return result;
 			}
 
-			integer_number<T> operator % (integer_number &other){
+			integer_number<T> operator % (const integer_number &other) const{
 				exact_number<T> op;
 				std::vector<T> dividend = (*this).digits;
 				std::vector<T> divisor = other.digits;
@@ -309,6 +296,54 @@ namespace boost{
 
 			integer_number<T> (std::vector<T> num, bool pos = true) : digits(num), positive(pos) {};
 
+			// constructor from any integral type, the digits are found by dividing by BASE, not by parsing a string
+			template <typename I, typename std::enable_if_t<std::is_integral<I>::value && !std::is_same<I, bool>::value, int> = 0>
+			constexpr explicit integer_number(I x){
+				using magnitude_t = unsigned long long;
+				positive = !(x < 0);
+				magnitude_t magnitude = positive ? (magnitude_t) x : (magnitude_t) 0 - (magnitude_t) x;
+
+				do{
+					digits.insert(digits.begin(), (T) (magnitude % (magnitude_t) BASE));
+					magnitude /= (magnitude_t) BASE;
+				}while(magnitude != 0);
+			}
+
+			/**
+			 * @brief: the integer of an exact_number with no fraction limbs. The limbs are taken over as they are,
+			 *         the trailing zero limbs exact_number drops are put back as the units
+			 **/
+			explicit integer_number(const exact_number<T> &number) : positive(number.positive){
+				const auto first = std::find_if(number.digits.begin(), number.digits.end(), [](T digit){ return digit != 0; });
+				if(first == number.digits.end()){
+					digits = {0};
+					positive = true;
+					return;
+				}
+				const auto last = std::find_if(number.digits.rbegin(), number.digits.rend(), [](T digit){ return digit != 0; }).base();
+				const auto exponent = number.exponent - (first - number.digits.begin());
+				if(exponent < last - first)
+					throw integer_contructor_for_non_integer_type();
+				digits.reserve(exponent);
+				digits.assign(first, last);
+				digits.resize(exponent, 0);
+			}
+
+			// the exact_number of the same value in its normalized form, the limbs are copied over as they are
+			exact_number<T> to_exact_number() const{
+				exact_number<T> result;
+				const auto first = std::find_if(digits.begin(), digits.end(), [](T digit){ return digit != 0; });
+				if(first == digits.end()){
+					result.digits = {0};
+					return result;
+				}
+				const auto last = std::find_if(digits.rbegin(), digits.rend(), [](T digit){ return digit != 0; }).base();
+				result.digits.assign(first, last);
+				result.exponent = (typename exact_number<T>::exponent_t) (digits.end() - first);
+				result.positive = positive;
+				return result;
+			}
+
 			/**
 			 *@brief *Copy Constructor:* It creates an integer type real number that is a copy of 
 			 *other integer type real number.
@@ -339,43 +374,15 @@ namespace boost{
 					return ;
 				}
 
-				for(const auto& c : integer_part){
-					digits.push_back(c - '0');
-				}
-
 				positive = _positive;
 
-				std::vector<T> base;
-				T b = BASE;
-				while(b != 0)
+				// the zeros of the exponent go after the digits, then the whole is taken to limbs by halves
+				std::string decimal_digits(integer_part);
+				if(exponent > (int) decimal_digits.size())
 				{
-					base.push_back(b % 10);
-					b /= 10;
+					decimal_digits.append(exponent - decimal_digits.size(), '0');
 				}
-				std::reverse(base.begin(), base.end());
-				int curr_size = digits.size();
-
-				for (int i = 0; i < exponent-curr_size; ++i) {
-                    digits.push_back(0);
-                }
-                exact_number<T> op;
-                std::vector<T> new_digits;
-                while (!digits.empty()) {
-                    std::vector<T> quotient;
-                    //std::vector<T> rem;
-                    std::vector<T> rem = op.long_divide_vectors(digits, base, quotient, 10);
-                    T result = 0;
-                    for (auto d : rem)  
-                    {
-                        result = result * 10 + d;
-                    }
-                    
-                    new_digits.push_back(result);
-                    digits = quotient;
-                }
-                
-                std::reverse (new_digits.begin(), new_digits.end());
-                digits = new_digits;
+				digits = exact_number<T>::limbs_from_decimal(decimal_digits);
 
 			}
 
@@ -385,14 +392,12 @@ namespace boost{
 
             // return integer divided by divider
 			// Note: result will return a integer. 
-			integer_number<T> divide(integer_number<T> &divider){
-				exact_number<T> op;
+			integer_number<T> divide(const integer_number<T> &divider) const{
 				std::vector<T> quotient;
 				std::vector<T> remainder;
-				// need to change this line after new long divide algo.
-				// this will produce wrong result, because this algo will do calculations in decimal base.
-				op.knuth_division(digits, divider.digits, quotient, remainder);
-				integer_number<T> result(quotient, !(positive^divider.positive));
+				exact_number<T>::knuth_division(digits, divider.digits, quotient, remainder, BASE);
+				if(quotient.empty()) quotient.push_back(0);
+				integer_number<T> result(quotient, !(positive^divider.positive) || quotient[0] == 0);
 				return result;
 			}
 
@@ -400,23 +405,338 @@ namespace boost{
 
 		namespace literals{
 			template<typename T>
-			const integer_number<T> zero_integer = integer_number<T>("0");
+			const integer_number<T> zero_integer = integer_number<T>(0);
 
 			template<typename T>
-			const integer_number<T> one_integer = integer_number<T>("1");
+			const integer_number<T> one_integer = integer_number<T>(1);
+		}
+
+		namespace detail{
+
+			/// the number of leading limbs of an integer_number<T> that Lehmer's steps work on, their value stays below 2^62
+			template<typename T>
+			constexpr int lehmer_limbs(){
+				int limbs = 0;
+				unsigned long long word = 1;
+				while(word <= (1ULL << 62) / (unsigned long long) integer_number<T>::BASE){
+					word *= (unsigned long long) integer_number<T>::BASE;
+					++limbs;
+				}
+				return limbs;
+			}
+
+			/// the value of the limbs [first, first + count) of digits, limbs out of the vector count as zero
+			template<typename T>
+			unsigned long long limbs_value(const std::vector<T> &digits, long long first, int count){
+				unsigned long long value = 0;
+				for(long long i = first; i < first + count; ++i){
+					value *= (unsigned long long) integer_number<T>::BASE;
+					if(i >= 0 && i < (long long) digits.size()) value += (unsigned long long) digits[i];
+				}
+				return value;
+			}
+
+			/// binary (Stein's) gcd of two words, it only shifts and subtracts
+			inline unsigned long long binary_gcd(unsigned long long u, unsigned long long v){
+				if(u == 0) return v;
+				if(v == 0) return u;
+				int shift = 0;
+				while(((u | v) & 1) == 0){
+					u >>= 1;
+					v >>= 1;
+					++shift;
+				}
+				while((u & 1) == 0) u >>= 1;
+				while(v != 0){
+					while((v & 1) == 0) v >>= 1;
+					if(u > v) std::swap(u, v);
+					v -= u;
+				}
+				return u << shift;
+			}
+
+			/// a and b divided, quotient and remainder without leading zeros and {0} when zero
+			template<typename T>
+			void divide_integers(const integer_number<T> &a, const integer_number<T> &b, integer_number<T> &quotient, integer_number<T> &remainder){
+				exact_number<T>::knuth_division(a.digits, b.digits, quotient.digits, remainder.digits, integer_number<T>::BASE);
+				if(quotient.digits.empty()) quotient.digits.push_back(0);
+				if(remainder.digits.empty()) remainder.digits.push_back(0);
+				quotient.positive = remainder.positive = true;
+			}
+
+			/// floor(value^(1 / n)) of a machine word, the floating point estimate corrected to the exact floor
+			inline unsigned long long word_root(unsigned long long value, unsigned int n){
+				if(value < 2 || n == 1) return value;
+				if(n >= 64) return 1;
+				// whether x^n > value, without overflowing
+				auto exceeds = [value, n](unsigned long long x){
+					unsigned long long power = 1;
+					for(unsigned int i = 0; i < n; ++i){
+						if(power > value / x) return true;
+						power *= x;
+					}
+					return false;
+				};
+				unsigned long long root = (unsigned long long) std::pow((long double) value, 1.0L / n);
+				while(root > 1 && exceeds(root)) --root;
+				while(!exceeds(root + 1)) ++root;
+				return root;
+			}
+
+			/// the number without its `count` lowest limbs
+			template<typename T>
+			integer_number<T> high_limbs(const integer_number<T> &number, size_t count){
+				if(number.digits.size() <= count) return integer_number<T>(0);
+				return integer_number<T>(std::vector<T>(number.digits.begin(), number.digits.end() - count));
+			}
+
+			/**
+			 * @brief: the cofactors of a Lehmer step, a' = A a + B b and b' = C a + D b. B is zero when the
+			 *         leading limbs gave no quotient, odd tells the number of Euclid steps is odd
+			 **/
+			struct lehmer_cofactors{
+				long long A, B, C, D;
+				bool odd;
+			};
+
+			/**
+			 * LEHMER STEP
+			 * @brief: runs Euclid's algorithm on the leading limbs of a >= b, aligned to the length of a, as long as
+			 *         both ends of the interval of the true quotient give the same quotient. The cofactors then
+			 *         replace that many multi-precision division steps by four products of a limb-sized number.
+			 * @ref: D. Knuth, The Art of Computer Programming Vol. 2, 4.5.2 Algorithm L
+			 **/
+			template<typename T>
+			lehmer_cofactors lehmer_step(const integer_number<T> &a, const integer_number<T> &b){
+				constexpr int limbs = lehmer_limbs<T>();
+				lehmer_cofactors cofactors = {1, 0, 0, 1, false};
+				if(limbs == 0) return cofactors;
+				long long a_hat = (long long) limbs_value(a.digits, 0, limbs);
+				long long b_hat = (long long) limbs_value(b.digits, (long long) b.digits.size() - (long long) a.digits.size(), limbs);
+				while(b_hat + cofactors.C > 0 && b_hat + cofactors.D > 0){
+					const long long q = (a_hat + cofactors.A) / (b_hat + cofactors.C);
+					if(q != (a_hat + cofactors.B) / (b_hat + cofactors.D)) break;
+					long long t = cofactors.A - q * cofactors.C;
+					cofactors.A = cofactors.C;
+					cofactors.C = t;
+					t = cofactors.B - q * cofactors.D;
+					cofactors.B = cofactors.D;
+					cofactors.D = t;
+					t = a_hat - q * b_hat;
+					a_hat = b_hat;
+					b_hat = t;
+					cofactors.odd = !cofactors.odd;
+				}
+				return cofactors;
+			}
+
+			/// |x a + y b|, for cofactors of opposite signs (or zero) it is the difference of two products
+			template<typename T>
+			integer_number<T> combine(long long x, const integer_number<T> &a, long long y, const integer_number<T> &b){
+				integer_number<T> result = integer_number<T>(x) * a + integer_number<T>(y) * b;
+				result.positive = true;
+				return result;
+			}
+
+			/**
+			 * @brief: a matrix of the half gcd, the product of the Euclid steps [q 1; 1 0] taken, so that the
+			 *         (a, b) it started from are m (a', b'). All entries are non-negative and its determinant is
+			 *         -1 when odd, 1 otherwise
+			 **/
+			template<typename T>
+			struct gcd_matrix{
+				integer_number<T> m00 = integer_number<T>(1), m01 = integer_number<T>(0);
+				integer_number<T> m10 = integer_number<T>(0), m11 = integer_number<T>(1);
+				bool odd = false;
+
+				/// this matrix times other
+				void multiply(const gcd_matrix<T> &other){
+					integer_number<T> r00 = m00 * other.m00 + m01 * other.m10;
+					integer_number<T> r01 = m00 * other.m01 + m01 * other.m11;
+					integer_number<T> r10 = m10 * other.m00 + m11 * other.m10;
+					integer_number<T> r11 = m10 * other.m01 + m11 * other.m11;
+					m00 = r00; m01 = r01; m10 = r10; m11 = r11;
+					odd = odd != other.odd;
+				}
+
+				/// the matrix of the Euclid step with quotient q
+				void multiply_step(const integer_number<T> &q){
+					integer_number<T> r00 = m00 * q + m01;
+					integer_number<T> r10 = m10 * q + m11;
+					m01 = m00; m11 = m10;
+					m00 = r00; m10 = r10;
+					odd = !odd;
+				}
+
+				/// the matrix of a Lehmer step, the inverse of its cofactors
+				void multiply_step(const lehmer_cofactors &step){
+					gcd_matrix<T> inverse;
+					inverse.m00 = integer_number<T>(step.D < 0 ? -step.D : step.D);
+					inverse.m01 = integer_number<T>(step.B < 0 ? -step.B : step.B);
+					inverse.m10 = integer_number<T>(step.C < 0 ? -step.C : step.C);
+					inverse.m11 = integer_number<T>(step.A < 0 ? -step.A : step.A);
+					inverse.odd = step.odd;
+					multiply(inverse);
+				}
+
+				bool is_identity() const{
+					return m01 == literals::zero_integer<T> && m10 == literals::zero_integer<T>;
+				}
+
+				/**
+				 * @brief: (a, b) = m^-1 (a, b), if the result is a valid pair of remainders of a and b, a > b >= 0
+				 * @return: false, leaving a and b as they were, when it is not: the steps of the matrix were found
+				 *          on the leading limbs of a and b and their last quotients may not be the true ones
+				 **/
+				bool apply_inverse(integer_number<T> &a, integer_number<T> &b) const{
+					// m^-1 = det [m11 -m01; -m10 m00]
+					integer_number<T> new_a = odd ? m01 * b - m11 * a : m11 * a - m01 * b;
+					integer_number<T> new_b = odd ? m10 * a - m00 * b : m00 * b - m10 * a;
+					if(!new_a.positive || !new_b.positive || new_a <= new_b) return false;
+					a = new_a;
+					b = new_b;
+					return true;
+				}
+			};
+
+			/**
+			 * HALF GCD
+			 * @brief: reduces a >= b, of n limbs, with Euclid steps until b has about n / 2 limbs, and returns
+			 *         the matrix of those steps. The steps of the upper half of a and b are found recursively
+			 *         on their leading limbs, applied to the whole numbers and then the same is done with the
+			 *         second quarter, so the cost is that of a few products of n / 2 limbs at each level.
+			 * @ref: N. Möller, On Schönhage's algorithm and subquadratic integer gcd computation, Math. Comp. 2008
+			 **/
+			template<typename T>
+			gcd_matrix<T> half_gcd(integer_number<T> a, integer_number<T> b){
+				gcd_matrix<T> matrix;
+				const size_t n = a.digits.size();
+				const size_t s = n / 2 + 1;
+				if(b.digits.size() <= s) return matrix;
+
+				// the recursive calls, on the numbers without their lowest p limbs
+				if(n >= (size_t) algorithm_thresholds<T>::get().half_gcd){
+					for(size_t p : {s, (s + (size_t) b.digits.size()) / 2}){
+						if(b.digits.size() <= s + 1 || p >= b.digits.size()) break;
+						gcd_matrix<T> upper = half_gcd(high_limbs(a, p), high_limbs(b, p));
+						if(upper.is_identity() || !upper.apply_inverse(a, b)) continue;
+						matrix.multiply(upper);
+					}
+				}
+
+				// the rest of the way with Lehmer and Euclid steps
+				while(b.digits.size() > s){
+					lehmer_cofactors step = {1, 0, 0, 1, false};
+					if(b.digits.size() > s + 1) step = lehmer_step(a, b);
+					if(step.B != 0){
+						integer_number<T> new_a = combine(step.A, a, step.B, b);
+						b = combine(step.C, a, step.D, b);
+						a = new_a;
+						matrix.multiply_step(step);
+					}else{
+						integer_number<T> q, r;
+						divide_integers(a, b, q, r);
+						a = b;
+						b = r;
+						matrix.multiply_step(q);
+					}
+				}
+				return matrix;
+			}
 		}
 
 		/* GREATEST COMMON DIVISOR
-		 * @brief: to find GCD/HCF of two integers
+		 * @brief: to find GCD/HCF of two integers, with Lehmer's algorithm: the Euclid quotients are found
+		 *         on the leading limbs of the numbers, a limb-sized step at a time. Above the half_gcd
+		 *         threshold the half gcd reduces the numbers by half their length at once, and once both fit
+		 *         in a word the binary gcd finishes. The result is positive
 		 * @param: a: an integer_number object which represents the first integer in GCD operation.
 		 * @param: b: an integer_number object which represents the second integer in GCD operation.
 		 * @author: Vikram Singh Chundawat.
 		 **/
 		template<typename T>
 		integer_number<T> gcd(integer_number<T> a, integer_number<T> b) { 
-    		if (b == literals::zero_integer<T>) 
-        		return a; 
-    		return gcd(b, a % b);    
+			constexpr int limbs = detail::lehmer_limbs<T>();
+			a.positive = b.positive = true;
+			if(a < b) std::swap(a, b);
+			while(b != literals::zero_integer<T>){
+				if(a.digits.size() <= (size_t) limbs)
+					return integer_number<T>(detail::binary_gcd(detail::limbs_value(a.digits, 0, a.digits.size()), detail::limbs_value(b.digits, 0, b.digits.size())));
+
+				if(b.digits.size() >= (size_t) algorithm_thresholds<T>::get().half_gcd && a.digits.size() <= b.digits.size() + 1){
+					// the steps of the upper two thirds of the numbers bring them down by a third of their length
+					const size_t p = a.digits.size() / 3;
+					detail::gcd_matrix<T> matrix = detail::half_gcd(detail::high_limbs(a, p), detail::high_limbs(b, p));
+					if(!matrix.is_identity() && matrix.apply_inverse(a, b)) continue;
+				}
+
+				detail::lehmer_cofactors step = {1, 0, 0, 1, false};
+				if(a.digits.size() == b.digits.size()) step = detail::lehmer_step(a, b);
+				if(step.B != 0){
+					integer_number<T> new_a = detail::combine(step.A, a, step.B, b);
+					b = detail::combine(step.C, a, step.D, b);
+					a = new_a;
+				}else{
+					integer_number<T> q, r;
+					detail::divide_integers(a, b, q, r);
+					a = b;
+					b = r;
+				}
+			}
+			return a;
+		}
+
+		/* EXTENDED GREATEST COMMON DIVISOR
+		 * @brief: the gcd g of a and b together with x and y such that a x + b y = g, x is the inverse of a
+		 *         modulo b when g is one. The steps are those of gcd, with the cofactor of a carried along
+		 * @param: a, b: the integers
+		 * @param: x, y: set to the cofactors of a and b
+		 **/
+		template<typename T>
+		integer_number<T> extended_gcd(integer_number<T> a, integer_number<T> b, integer_number<T> &x, integer_number<T> &y){
+			const integer_number<T> a0 = abs(a), b0 = abs(b);
+			const bool a_positive = a.positive, b_positive = b.positive;
+			a.positive = b.positive = true;
+
+			// u and v are the cofactors of a0 in the current a and b
+			integer_number<T> u(1), v(0);
+			if(a < b){
+				std::swap(a, b);
+				std::swap(u, v);
+			}
+			while(b != literals::zero_integer<T>){
+				detail::lehmer_cofactors step = {1, 0, 0, 1, false};
+				if(a.digits.size() == b.digits.size()) step = detail::lehmer_step(a, b);
+				if(step.B != 0){
+					integer_number<T> new_a = detail::combine(step.A, a, step.B, b);
+					b = detail::combine(step.C, a, step.D, b);
+					a = new_a;
+					integer_number<T> new_u = integer_number<T>(step.A) * u + integer_number<T>(step.B) * v;
+					v = integer_number<T>(step.C) * u + integer_number<T>(step.D) * v;
+					u = new_u;
+				}else{
+					integer_number<T> q, r;
+					detail::divide_integers(a, b, q, r);
+					a = b;
+					b = r;
+					integer_number<T> new_v = u - q * v;
+					u = v;
+					v = new_v;
+				}
+			}
+
+			// y = (g - a0 x) / b0, an exact division
+			x = u;
+			if(b0 == literals::zero_integer<T>){
+				y = integer_number<T>(0);
+			}else{
+				integer_number<T> rest = a - a0 * x, remainder;
+				detail::divide_integers(abs(rest), b0, y, remainder);
+				y.positive = rest.positive || y == literals::zero_integer<T>;
+			}
+			if(!a_positive) x = -x;
+			if(!b_positive) y = -y;
+			return a;
 		}
 
 		// HCF is same as GCD, only if someone choose to call HCF in place of GCD
@@ -445,6 +765,99 @@ namespace boost{
 			return result;
 		}
 
+		/**
+		 * INTEGER POWER
+		 * @brief: num^exponent, by repeated squaring
+		 * @param: num: the integer to be raised to exponent
+		 * @param: exponent: a non negative exponent
+		 **/
+		template<typename T>
+		integer_number<T> ipow(integer_number<T> num, unsigned int exponent){
+			integer_number<T> result(1);
+			while(exponent > 0){
+				if(exponent % 2 == 1) result *= num;
+				exponent /= 2;
+				if(exponent > 0) num = num * num;
+			}
+			return result;
+		}
+
+		namespace detail{
+
+			/**
+			 * @brief: floor(num^(1 / n)) of a positive num, by Newton's iteration x <- ((n - 1) x + num / x^(n - 1)) / n,
+			 *         which goes down to the floor of the root from any start above it. The start is the root of
+			 *         the leading limbs of num, taken recursively and scaled up, which is right to half the limbs
+			 *         of the root, so a step or two finish: every level of the recursion doubles the precision
+			 *         and the cost is a few products and divisions of the length of num
+			 **/
+			template<typename T>
+			integer_number<T> root_of_magnitude(const integer_number<T> &num, unsigned int n){
+				const size_t length = num.digits.size();
+				if(length <= (size_t) lehmer_limbs<T>())
+					return integer_number<T>(word_root(limbs_value(num.digits, 0, length), n));
+				// a limb holds less than 64 bits, so the root of a longer index is one
+				if((unsigned long long) n >= 64ULL * length)
+					return integer_number<T>(1);
+
+				// the root has about length / n limbs, the limbs of num above shift * n give the leading half
+				const size_t shift = length / n / 2;
+				integer_number<T> x;
+				if(shift == 0){
+					// base^ceil(length / n) is above the root
+					x.digits.assign((length + n - 1) / n + 1, 0);
+					x.digits[0] = 1;
+				}else{
+					x = root_of_magnitude(high_limbs(num, shift * n), n) + integer_number<T>(1);
+					x.digits.resize(x.digits.size() + shift, 0);
+				}
+
+				const integer_number<T> index(n), index_1(n - 1);
+				while(true){
+					integer_number<T> quotient, remainder, next;
+					divide_integers(num, ipow(x, n - 1), quotient, remainder);
+					divide_integers(index_1 * x + quotient, index, next, remainder);
+					if(!(next < x)) return x;
+					x = next;
+				}
+			}
+		}
+
+		/**
+		 * INTEGER N-TH ROOT
+		 * @brief: the integer part of num^(1 / n), the root of a negative num is negative. The precision
+		 *         doubling Newton iteration of detail::root_of_magnitude takes it in a few products
+		 * @param: num: the integer whose root is taken
+		 * @param: n: the index of the root, at least one
+		 * @throws: non_integral_power_of_negative_number for an even root of a negative number
+		 **/
+		template<typename T>
+		integer_number<T> iroot(integer_number<T> num, unsigned int n){
+			if(n == 0)
+				throw divide_by_zero();
+			const bool positive = num.positive || num == literals::zero_integer<T>;
+			if(!positive && n % 2 == 0)
+				throw non_integral_power_of_negative_number();
+			num.positive = true;
+			if(num == literals::zero_integer<T> || n == 1){
+				num.positive = positive;
+				return num;
+			}
+			integer_number<T> root = detail::root_of_magnitude(num, n);
+			root.positive = positive;
+			return root;
+		}
+
+		/**
+		 * INTEGER SQUARE ROOT
+		 * @brief: the integer part of the square root of a non negative num
+		 * @throws: non_integral_power_of_negative_number for a negative num
+		 **/
+		template<typename T>
+		inline integer_number<T> isqrt(const integer_number<T> &num){
+			return iroot(num, 2);
+		}
+
 		/**
 		 * ABSOLUTE VALUE OF INTEGER_NUMBER
 		 * @brief: it will retuen the absolute value of integer_number.
@@ -84,9 +84,7 @@ namespace boost {
 
                 static exact_number<T> L0 = real_l0.get_exact_number();
                 static exact_number<T> X0 = real_x0.get_exact_number();
-                static exact_number<T> _16(std::vector<T> {16}, 1, true);
                 static exact_number<T> _12(std::vector<T> {12}, 1, true);
-                static exact_number<T> one("1");
 
                 static boost::real::const_precision_iterator<T> real_c_itr = real_c.get_real_itr();
                 real_c_itr.set_maximum_precision(n + 1);
@@ -96,15 +94,26 @@ namespace boost {
                 bool nth_digit_found = false;
                 bool first_iteration_over = false;
 
-                exact_number<T> iteration_number = one;
+                T iteration_number = 1;
                 exact_number<T> prev_pi;
                 exact_number<T> pi;
                 exact_number<T> error;
                 const exact_number<T> max_error(std::vector<T> {1}, -(n + 1), true);
 
                 do {  
-                    exact_number<T> temp = K * K * K - _16 * K;
-                    temp.divide_vector(iteration_number * iteration_number * iteration_number, n + 1, true);
+                    // K^3 - 16K, the cube accumulated onto -16K in place
+                    exact_number<T> temp = K;
+                    temp.multiply_by_small(16);
+                    temp.positive = !temp.positive;
+                    fma(temp, K * K, K);
+                    // a single pass divides by the cube of the iteration number while it is a digit
+                    if (iteration_number <= limb_traits<T>::max_digit / iteration_number / iteration_number) {
+                        temp.divide_by_small(iteration_number * iteration_number * iteration_number, n + 1, true);
+                    } else {
+                        for (int i = 0; i < 3; ++i) {
+                            temp.divide_by_small(iteration_number, n + 1, true);
+                        }
+                    }
                     M *= temp;
                     X *= X0;
                     L += L0;
@@ -121,7 +130,7 @@ namespace boost {
                     if (!first_iteration_over) {
                         prev_pi = pi;
                         first_iteration_over = true;
-                        iteration_number += one;
+                        ++iteration_number;
                     } else {
                         error = pi - prev_pi;
                         error.positive = true;
@@ -129,7 +138,7 @@ namespace boost {
                         if (error < max_error) {
                             nth_digit_found = true;
                         }
-                        iteration_number += one;
+                        ++iteration_number;
                         prev_pi = pi;
                     }
 
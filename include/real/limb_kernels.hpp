@@ -0,0 +1,318 @@
+#ifndef BOOST_REAL_LIMB_KERNELS_HPP
+#define BOOST_REAL_LIMB_KERNELS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// the vector kernels need the target attribute and the cpu builtins of gcc and clang on x86,
+// BOOST_REAL_NO_SIMD keeps every limb kernel on its portable scalar loop
+#if !defined(BOOST_REAL_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BOOST_REAL_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace boost {
+    namespace real {
+        namespace detail {
+
+            /**
+             *  @brief: LIMB KERNELS: AVX2 versions of the carry propagating loops of exact_number, chosen at
+             *          run time by CPUID. Each simd_* function returns false when it does not handle the call
+             *          (no AVX2, an unsupported limb type or a span too short to pay off), and the caller then
+             *          runs its own scalar loop, which stays the reference implementation.
+             *
+             *          Digits are stored most significant first, so inside a block of lanes the carry moves
+             *          from the last lane to the first one. The kernels add or subtract all the lanes at
+             *          once, take a generate mask (the lane overflows by itself) and a propagate mask (the
+             *          lane overflows only with an incoming carry), and resolve the carries of the whole
+             *          block with one integer addition on the bit reversed masks:
+             *
+             *              carries = X | ((P + X) ^ P ^ X),  X = (G << 1) | carry_in
+             */
+
+            /// whether the vector kernels are used, true on CPUs with AVX2. Benchmarks clear it to time the scalar loops.
+            inline bool &use_simd_kernels() {
+#if defined(BOOST_REAL_X86_DISPATCH)
+                static bool enabled = __builtin_cpu_supports("avx2");
+#else
+                static bool enabled = false;
+#endif
+                return enabled;
+            }
+
+            /// 4 and 8 byte signed limbs go through the vector add, subtract and compare kernels
+            template <typename T>
+            constexpr bool simd_limb = std::is_integral<T>::value && std::is_signed<T>::value &&
+                                       (sizeof(T) == 4 || sizeof(T) == 8);
+
+            /// shortest spans the vector kernels take, below it the scalar loops are as fast
+            constexpr std::size_t SIMD_MIN_LENGTH = 16;
+
+#if defined(BOOST_REAL_X86_DISPATCH)
+
+            /// bit reversal of the lowest Bits bits of mask, Bits <= 8
+            template <int Bits>
+            inline unsigned reverse_lanes(unsigned mask) {
+                static constexpr unsigned char nibbles[16] = {0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15};
+                const unsigned reversed = (nibbles[mask & 15u] << 4) | nibbles[(mask >> 4) & 15u];
+                return reversed >> (8 - Bits);
+            }
+
+            /// carries into every lane of a block from lane masks in memory order, carry_in enters the last
+            /// lane. The carries come back in reversed order, bit i for lane Lanes - 1 - i.
+            template <int Lanes>
+            inline unsigned resolve_carries(unsigned generate, unsigned propagate, unsigned carry_in, unsigned &carry_out) {
+                const unsigned g = reverse_lanes<Lanes>(generate);
+                const unsigned p = reverse_lanes<Lanes>(propagate);
+                const unsigned x = (g << 1) | carry_in;
+                const unsigned carries = x | ((p + x) ^ p ^ x);
+                carry_out = (carries >> Lanes) & 1u;
+                return carries;
+            }
+
+            /// lanes of 4 byte limbs set to 1 where the reversed carries of resolve_carries are set
+            __attribute__((target("avx2")))
+            inline __m256i expand_mask_32(unsigned mask) {
+                const __m256i bits = _mm256_setr_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+                __m256i selected = _mm256_and_si256(_mm256_set1_epi32((int) mask), bits);
+                return _mm256_srli_epi32(_mm256_cmpeq_epi32(selected, bits), 31);
+            }
+
+            /// lanes of 8 byte limbs set to 1 where the reversed carries of resolve_carries are set
+            __attribute__((target("avx2")))
+            inline __m256i expand_mask_64(unsigned mask) {
+                const __m256i bits = _mm256_setr_epi64x(8, 4, 2, 1);
+                __m256i selected = _mm256_and_si256(_mm256_set1_epi64x((long long) mask), bits);
+                return _mm256_srli_epi64(_mm256_cmpeq_epi64(selected, bits), 63);
+            }
+
+            template <typename T>
+            __attribute__((target("avx2")))
+            inline T add_in_place_avx2(T* r, const T* b, std::size_t n, T max_digit) {
+                constexpr int lanes = 32 / sizeof(T);
+                unsigned carry = 0;
+                std::size_t i = n;
+                if constexpr (sizeof(T) == 4) {
+                    const __m256i max = _mm256_set1_epi32((int) max_digit);
+                    const __m256i radix = _mm256_set1_epi32((int) max_digit + 1);
+                    for (; i >= (std::size_t) lanes; i -= lanes) {
+                        __m256i* lane = (__m256i*) (r + i - lanes);
+                        __m256i sum = _mm256_add_epi32(_mm256_loadu_si256(lane), _mm256_loadu_si256((const __m256i*) (b + i - lanes)));
+                        unsigned generate = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(sum, max)));
+                        unsigned propagate = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(sum, max)));
+                        sum = _mm256_add_epi32(sum, expand_mask_32(resolve_carries<lanes>(generate, propagate, carry, carry)));
+                        sum = _mm256_sub_epi32(sum, _mm256_and_si256(_mm256_cmpgt_epi32(sum, max), radix));
+                        _mm256_storeu_si256(lane, sum);
+                    }
+                } else {
+                    const __m256i max = _mm256_set1_epi64x((long long) max_digit);
+                    const __m256i radix = _mm256_set1_epi64x((long long) max_digit + 1);
+                    for (; i >= (std::size_t) lanes; i -= lanes) {
+                        __m256i* lane = (__m256i*) (r + i - lanes);
+                        __m256i sum = _mm256_add_epi64(_mm256_loadu_si256(lane), _mm256_loadu_si256((const __m256i*) (b + i - lanes)));
+                        unsigned generate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(sum, max)));
+                        unsigned propagate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(sum, max)));
+                        sum = _mm256_add_epi64(sum, expand_mask_64(resolve_carries<lanes>(generate, propagate, carry, carry)));
+                        sum = _mm256_sub_epi64(sum, _mm256_and_si256(_mm256_cmpgt_epi64(sum, max), radix));
+                        _mm256_storeu_si256(lane, sum);
+                    }
+                }
+
+                T carry_digit = (T) carry;
+                while (i-- > 0) {
+                    T sum = r[i] + b[i] + carry_digit;
+                    carry_digit = (sum > max_digit);
+                    r[i] = carry_digit ? sum - max_digit - 1 : sum;
+                }
+                return carry_digit;
+            }
+
+            template <typename T>
+            __attribute__((target("avx2")))
+            inline T subtract_in_place_avx2(T* r, const T* b, std::size_t n, T max_digit) {
+                constexpr int lanes = 32 / sizeof(T);
+                unsigned borrow = 0;
+                std::size_t i = n;
+                if constexpr (sizeof(T) == 4) {
+                    const __m256i zero = _mm256_setzero_si256();
+                    const __m256i radix = _mm256_set1_epi32((int) max_digit + 1);
+                    for (; i >= (std::size_t) lanes; i -= lanes) {
+                        __m256i* lane = (__m256i*) (r + i - lanes);
+                        __m256i difference = _mm256_sub_epi32(_mm256_loadu_si256(lane), _mm256_loadu_si256((const __m256i*) (b + i - lanes)));
+                        unsigned generate = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(zero, difference)));
+                        unsigned propagate = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(difference, zero)));
+                        difference = _mm256_sub_epi32(difference, expand_mask_32(resolve_carries<lanes>(generate, propagate, borrow, borrow)));
+                        difference = _mm256_add_epi32(difference, _mm256_and_si256(_mm256_cmpgt_epi32(zero, difference), radix));
+                        _mm256_storeu_si256(lane, difference);
+                    }
+                } else {
+                    const __m256i zero = _mm256_setzero_si256();
+                    const __m256i radix = _mm256_set1_epi64x((long long) max_digit + 1);
+                    for (; i >= (std::size_t) lanes; i -= lanes) {
+                        __m256i* lane = (__m256i*) (r + i - lanes);
+                        __m256i difference = _mm256_sub_epi64(_mm256_loadu_si256(lane), _mm256_loadu_si256((const __m256i*) (b + i - lanes)));
+                        unsigned generate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(zero, difference)));
+                        unsigned propagate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(difference, zero)));
+                        difference = _mm256_sub_epi64(difference, expand_mask_64(resolve_carries<lanes>(generate, propagate, borrow, borrow)));
+                        difference = _mm256_add_epi64(difference, _mm256_and_si256(_mm256_cmpgt_epi64(zero, difference), radix));
+                        _mm256_storeu_si256(lane, difference);
+                    }
+                }
+
+                T borrow_digit = (T) borrow;
+                while (i-- > 0) {
+                    T sub = b[i] + borrow_digit;
+                    if (r[i] >= sub) {
+                        r[i] -= sub;
+                        borrow_digit = 0;
+                    } else {
+                        r[i] += (max_digit - sub) + 1;
+                        borrow_digit = 1;
+                    }
+                }
+                return borrow_digit;
+            }
+
+            /// index of the first digit where x and y differ, n if they are equal
+            template <typename T>
+            __attribute__((target("avx2")))
+            inline std::size_t mismatch_avx2(const T* x, const T* y, std::size_t n) {
+                constexpr std::size_t lanes = 32 / sizeof(T);
+                std::size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    __m256i lhs = _mm256_loadu_si256((const __m256i*) (x + i));
+                    __m256i rhs = _mm256_loadu_si256((const __m256i*) (y + i));
+                    __m256i equal = (sizeof(T) == 4) ? _mm256_cmpeq_epi32(lhs, rhs) : _mm256_cmpeq_epi64(lhs, rhs);
+                    unsigned mask = ~(unsigned) _mm256_movemask_epi8(equal);
+                    if (mask != 0) {
+                        return i + __builtin_ctz(mask) / sizeof(T);
+                    }
+                }
+                while (i < n && x[i] == y[i]) {
+                    ++i;
+                }
+                return i;
+            }
+
+            /**
+             *  @brief: schoolbook product of 4 byte limbs with multiply-accumulate rows. Rows of limb products
+             *          are added into 64 bit column sums four lanes at a time, and the columns are reduced to
+             *          digits once for a batch of rows instead of once per product, so most divisions by
+             *          the base disappear. A batch holds as many rows as the column sums can take without
+             *          overflowing.
+             */
+            template <typename T>
+            __attribute__((target("avx2")))
+            inline void multiply_basecase_avx2(T* r, const T* a, std::size_t na, const T* b, std::size_t nb, T base) {
+                const std::uint64_t wide_base = (std::uint64_t) base;
+                const std::uint64_t largest_product = (wide_base - 1) * (wide_base - 1);
+                const std::size_t batch = std::max<std::uint64_t>(1, std::min<std::uint64_t>(16, (UINT64_MAX / 2) / (largest_product + 1)));
+
+                // column c holds the digit r[c], b is widened to 64 bit lanes once
+                std::vector<std::uint64_t> columns(na + nb, 0);
+                std::vector<std::uint64_t> wide_b(b, b + nb);
+
+                for (std::size_t high = na; high > 0;) {
+                    const std::size_t low = (high > batch) ? high - batch : 0;
+
+                    for (std::size_t i = high; i-- > low;) {
+                        // row i ends at column i + nb
+                        std::uint64_t* row = columns.data() + i + 1;
+                        const __m256i digit = _mm256_set1_epi64x((long long) a[i]);
+                        std::size_t j = 0;
+                        for (; j + 4 <= nb; j += 4) {
+                            __m256i product = _mm256_mul_epu32(digit, _mm256_loadu_si256((const __m256i*) (wide_b.data() + j)));
+                            __m256i sum = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*) (row + j)), product);
+                            _mm256_storeu_si256((__m256i*) (row + j), sum);
+                        }
+                        for (; j < nb; ++j) {
+                            row[j] += (std::uint64_t) a[i] * wide_b[j];
+                        }
+                    }
+
+                    // reduces the columns the batch wrote, its carry waits in column low for the next batch
+                    std::uint64_t carry = 0;
+                    for (std::size_t c = high + nb; c-- > low + 1;) {
+                        std::uint64_t t = columns[c] + carry;
+                        columns[c] = t % wide_base;
+                        carry = t / wide_base;
+                    }
+                    columns[low] += carry;
+                    high = low;
+                }
+
+                for (std::size_t c = 0; c < na + nb; ++c) {
+                    r[c] = (T) columns[c];
+                }
+            }
+
+#endif
+
+            /// r[0..n) += b[0..n), see add_in_place of exact_number
+            template <typename T>
+            inline bool simd_add_in_place(T* r, const T* b, std::size_t n, T max_digit, T &carry) {
+#if defined(BOOST_REAL_X86_DISPATCH)
+                if constexpr (simd_limb<T>) {
+                    if (n >= SIMD_MIN_LENGTH && use_simd_kernels()) {
+                        carry = add_in_place_avx2(r, b, n, max_digit);
+                        return true;
+                    }
+                }
+#endif
+                (void) r; (void) b; (void) n; (void) max_digit; (void) carry;
+                return false;
+            }
+
+            /// r[0..n) -= b[0..n), see subtract_in_place of exact_number
+            template <typename T>
+            inline bool simd_subtract_in_place(T* r, const T* b, std::size_t n, T max_digit, T &borrow) {
+#if defined(BOOST_REAL_X86_DISPATCH)
+                if constexpr (simd_limb<T>) {
+                    if (n >= SIMD_MIN_LENGTH && use_simd_kernels()) {
+                        borrow = subtract_in_place_avx2(r, b, n, max_digit);
+                        return true;
+                    }
+                }
+#endif
+                (void) r; (void) b; (void) n; (void) max_digit; (void) borrow;
+                return false;
+            }
+
+            /// index of the first digit where x[0..n) and y[0..n) differ, or n
+            template <typename T>
+            inline bool simd_mismatch(const T* x, const T* y, std::size_t n, std::size_t &index) {
+#if defined(BOOST_REAL_X86_DISPATCH)
+                if constexpr (std::is_integral<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)) {
+                    if (n >= SIMD_MIN_LENGTH && use_simd_kernels()) {
+                        index = mismatch_avx2(x, y, n);
+                        return true;
+                    }
+                }
+#endif
+                (void) x; (void) y; (void) n; (void) index;
+                return false;
+            }
+
+            /// r[0..na + nb) = a[0..na) * b[0..nb), see multiply_basecase of exact_number
+            template <typename T>
+            inline bool simd_multiply_basecase(T* r, const T* a, std::size_t na, const T* b, std::size_t nb, T base) {
+#if defined(BOOST_REAL_X86_DISPATCH)
+                if constexpr (std::is_integral<T>::value && sizeof(T) == 4) {
+                    // the column sums take a batch of at least one row of products below 2^62
+                    if (nb >= SIMD_MIN_LENGTH && base > 1 && (std::uint64_t) base <= ((std::uint64_t) 1 << 31) && use_simd_kernels()) {
+                        multiply_basecase_avx2(r, a, na, b, nb, base);
+                        return true;
+                    }
+                }
+#endif
+                (void) r; (void) a; (void) na; (void) b; (void) nb; (void) base;
+                return false;
+            }
+        }
+    }
+}
+
+#endif // BOOST_REAL_LIMB_KERNELS_HPP
@@ -0,0 +1,128 @@
+#ifndef BOOST_REAL_LIMB_TRAITS_HPP
+#define BOOST_REAL_LIMB_TRAITS_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace boost {
+    namespace real {
+
+        namespace detail {
+
+            /// unsigned type holding at least twice the bits of a limb of Size bytes, void if none exists
+            template <std::size_t Size>
+            struct wide_unsigned {
+                using type = void;
+            };
+
+            template <>
+            struct wide_unsigned<1> {
+                using type = unsigned int;
+            };
+
+            template <>
+            struct wide_unsigned<2> {
+                using type = unsigned long;
+            };
+
+            template <>
+            struct wide_unsigned<4> {
+                using type = unsigned long long;
+            };
+
+#if defined(__SIZEOF_INT128__)
+            template <>
+            struct wide_unsigned<8> {
+                __extension__ typedef unsigned __int128 type;
+            };
+#endif
+
+            /// the number of bits of value, 0 for 0
+            template <typename T>
+            constexpr int bit_length(T value) {
+                int bits = 0;
+                for (; value > 0; value /= 2) {
+                    ++bits;
+                }
+                return bits;
+            }
+        }
+
+        /**
+         *  @brief: RADIX POLICIES: the base of the limbs of exact_number and integer_number, one base for
+         *          both, so the limbs of an integer are the limbs of the exact_number of the same value.
+         *
+         *          default_radix keeps the historic base, (max / 4) * 2, the max / 2 - 1 integer_number had
+         *          for the types whose max is 2^k - 1. binary_radix uses a power of two, 2^30 for 4 byte signed limbs,
+         *          2^62 for 8 byte ones and 2^63 for unsigned 8 byte ones, so a limb vector is the binary
+         *          representation of the number and scaling by a power of two shifts bits between limbs.
+         *
+         *          The library reads the policy of a limb type from radix_policy<T>. It is the policy named by
+         *          BOOST_REAL_RADIX_POLICY for every limb type, and it can be specialized to change a single one:
+         *
+         *              template <> struct boost::real::radix_policy<long long> { using type = binary_radix; };
+         *
+         *          Either choice has to be the same in every translation unit of a program.
+         */
+        struct default_radix {
+            template <typename T>
+            static constexpr T base() {
+                return (std::numeric_limits<T>::max() / 4) * 2;
+            }
+        };
+
+        struct binary_radix {
+            /// the largest power of two with two of its largest limbs and a carry at most max
+            template <typename T>
+            static constexpr T base() {
+                T power = 1;
+                while (power <= (std::numeric_limits<T>::max() / 2 + 1) / 2) {
+                    power *= 2;
+                }
+                return power;
+            }
+        };
+
+#ifndef BOOST_REAL_RADIX_POLICY
+#define BOOST_REAL_RADIX_POLICY boost::real::default_radix
+#endif
+
+        template <typename T>
+        struct radix_policy {
+            using type = BOOST_REAL_RADIX_POLICY;
+        };
+
+        /**
+         *  @brief: LIMB TRAITS: describes the arithmetic available for a limb (digit) type T of
+         *          exact_number. Kernels that multiply two limbs take their accumulator type from
+         *          wide_type, so that a full limb product plus a limb sized carry is computed with a
+         *          single native multiplication and one division by the base.
+         *
+         *          wide_type is void (and has_wide_type false) for limbs with no wider integer on the
+         *          target, those fall back to the shift-and-add routines of exact_number.
+         *
+         *  @tparam: T: integral limb type, signed or unsigned
+         */
+        template <typename T>
+        struct limb_traits {
+            static_assert(std::is_integral<T>::value, "limbs must be of an integral type");
+
+            using limb_type = T;
+            using wide_type = typename detail::wide_unsigned<sizeof(T)>::type;
+
+            static constexpr bool has_wide_type = !std::is_void<wide_type>::value;
+
+            /// the base of exact_number and integer_number limbs, and the largest limb, base - 1
+            static constexpr T base = radix_policy<T>::type::template base<T>();
+            static constexpr T max_digit = base - 1;
+            static_assert(base % 2 == 0, "the parity of an integer is the parity of its units limb");
+
+            /// whether base is a power of two, then a limb holds exactly base_bits bits
+            static constexpr bool binary_base = (base & (base - 1)) == 0;
+            static constexpr int base_bits = binary_base ? detail::bit_length(base) - 1 : 0;
+        };
+    }
+}
+
+#endif // BOOST_REAL_LIMB_TRAITS_HPP
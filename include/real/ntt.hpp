@@ -0,0 +1,312 @@
+#ifndef BOOST_REAL_NTT_HPP
+#define BOOST_REAL_NTT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <real/limb_traits.hpp>
+
+namespace boost {
+    namespace real {
+        namespace detail {
+
+            /**
+             *  @brief: NUMBER THEORETIC TRANSFORM: primes of the form c * 2^k + 1 below 2^31, with a primitive
+             *          root each. A product is convolved modulo as many of them as its coefficients need and
+             *          rebuilt with the chinese remainder theorem. They are sorted by size, so the first m
+             *          primes always give the largest modulus m primes can give.
+             */
+            template <int I>
+            struct ntt_prime;
+
+            template <>
+            struct ntt_prime<0> {
+                static constexpr uint32_t modulus = 2013265921; // 15 * 2^27 + 1
+                static constexpr uint32_t generator = 31;
+                static constexpr int max_log_length = 27;
+            };
+
+            template <>
+            struct ntt_prime<1> {
+                static constexpr uint32_t modulus = 998244353; // 119 * 2^23 + 1
+                static constexpr uint32_t generator = 3;
+                static constexpr int max_log_length = 23;
+            };
+
+            template <>
+            struct ntt_prime<2> {
+                static constexpr uint32_t modulus = 754974721; // 45 * 2^24 + 1
+                static constexpr uint32_t generator = 11;
+                static constexpr int max_log_length = 24;
+            };
+
+            template <>
+            struct ntt_prime<3> {
+                static constexpr uint32_t modulus = 469762049; // 7 * 2^26 + 1
+                static constexpr uint32_t generator = 3;
+                static constexpr int max_log_length = 26;
+            };
+
+            template <>
+            struct ntt_prime<4> {
+                static constexpr uint32_t modulus = 167772161; // 5 * 2^25 + 1
+                static constexpr uint32_t generator = 3;
+                static constexpr int max_log_length = 25;
+            };
+
+            constexpr int NTT_PRIME_COUNT = 5;
+
+            constexpr std::array<uint32_t, NTT_PRIME_COUNT> ntt_moduli = {
+                ntt_prime<0>::modulus, ntt_prime<1>::modulus, ntt_prime<2>::modulus,
+                ntt_prime<3>::modulus, ntt_prime<4>::modulus
+            };
+
+            constexpr std::array<int, NTT_PRIME_COUNT> ntt_max_log_lengths = {
+                ntt_prime<0>::max_log_length, ntt_prime<1>::max_log_length, ntt_prime<2>::max_log_length,
+                ntt_prime<3>::max_log_length, ntt_prime<4>::max_log_length
+            };
+
+            /// returns a^e mod m
+            inline uint32_t pow_mod(uint32_t a, uint64_t e, uint32_t m) {
+                uint64_t result = 1, power = a % m;
+                while (e > 0) {
+                    if (e & 1) {
+                        result = result * power % m;
+                    }
+                    power = power * power % m;
+                    e >>= 1;
+                }
+                return (uint32_t) result;
+            }
+
+            /**
+             *  @brief: in place iterative radix-2 transform of a, whose size is a power of two, modulo the
+             *          I-th prime. The prime is a compile time constant, so that every reduction compiles
+             *          to multiplications instead of a division.
+             *  @param: a: the coefficients, reduced modulo the prime
+             *  @param: inverse: computes the inverse transform, including the division by the size
+             */
+            template <int I>
+            void ntt_transform(std::vector<uint32_t> &a, bool inverse) {
+                constexpr uint64_t mod = ntt_prime<I>::modulus;
+                const size_t n = a.size();
+
+                for (size_t i = 1, j = 0; i < n; ++i) {
+                    size_t bit = n >> 1;
+                    for (; j & bit; bit >>= 1) {
+                        j ^= bit;
+                    }
+                    j ^= bit;
+                    if (i < j) {
+                        std::swap(a[i], a[j]);
+                    }
+                }
+
+                std::vector<uint32_t> roots(n / 2 + 1);
+                for (size_t length = 2; length <= n; length <<= 1) {
+                    uint32_t root = pow_mod(ntt_prime<I>::generator, (mod - 1) / length, mod);
+                    if (inverse) {
+                        root = pow_mod(root, mod - 2, mod);
+                    }
+                    const size_t half = length / 2;
+                    roots[0] = 1;
+                    for (size_t k = 1; k < half; ++k) {
+                        roots[k] = (uint32_t) ((uint64_t) roots[k - 1] * root % mod);
+                    }
+
+                    for (size_t i = 0; i < n; i += length) {
+                        for (size_t k = 0; k < half; ++k) {
+                            uint32_t u = a[i + k];
+                            uint32_t v = (uint32_t) ((uint64_t) a[i + k + half] * roots[k] % mod);
+                            a[i + k] = (u + v >= mod) ? (uint32_t) (u + v - mod) : u + v;
+                            a[i + k + half] = (u >= v) ? u - v : (uint32_t) (u + mod - v);
+                        }
+                    }
+                }
+
+                if (inverse) {
+                    const uint64_t size_inverse = pow_mod((uint32_t) (n % mod), mod - 2, mod);
+                    for (auto &x : a) {
+                        x = (uint32_t) (x * size_inverse % mod);
+                    }
+                }
+            }
+
+            /// cyclic convolution of a and b (both already sized to the transform length) modulo the I-th prime
+            template <int I, typename T>
+            std::vector<uint32_t> ntt_convolution(const std::vector<T> &a, const std::vector<T> &b, size_t length, bool square) {
+                constexpr uint32_t mod = ntt_prime<I>::modulus;
+
+                std::vector<uint32_t> fa(length, 0);
+                for (size_t i = 0; i < a.size(); ++i) {
+                    fa[i] = (uint32_t) ((uint64_t) a[i] % mod);
+                }
+                ntt_transform<I>(fa, false);
+
+                if (square) {
+                    for (auto &x : fa) {
+                        x = (uint32_t) ((uint64_t) x * x % mod);
+                    }
+                } else {
+                    std::vector<uint32_t> fb(length, 0);
+                    for (size_t i = 0; i < b.size(); ++i) {
+                        fb[i] = (uint32_t) ((uint64_t) b[i] % mod);
+                    }
+                    ntt_transform<I>(fb, false);
+                    for (size_t i = 0; i < length; ++i) {
+                        fa[i] = (uint32_t) ((uint64_t) fa[i] * fb[i] % mod);
+                    }
+                }
+
+                ntt_transform<I>(fa, true);
+                return fa;
+            }
+
+            template <typename T>
+            std::vector<uint32_t> ntt_convolution(int prime, const std::vector<T> &a, const std::vector<T> &b, size_t length, bool square) {
+                switch (prime) {
+                    case 0: return ntt_convolution<0>(a, b, length, square);
+                    case 1: return ntt_convolution<1>(a, b, length, square);
+                    case 2: return ntt_convolution<2>(a, b, length, square);
+                    case 3: return ntt_convolution<3>(a, b, length, square);
+                    default: return ntt_convolution<4>(a, b, length, square);
+                }
+            }
+
+            /// whether the carries of ntt_multiply can be divided by the base in the wide type of T
+            template <typename T>
+            constexpr bool ntt_supports_limb() {
+                if constexpr (limb_traits<T>::has_wide_type) {
+                    return sizeof(typename limb_traits<T>::wide_type) >= 8;
+                } else {
+                    return false;
+                }
+            }
+
+            /**
+             *  @brief: number of primes needed to multiply digit vectors of sizes a_size and b_size in the
+             *          given base, i.e. to hold min(a_size, b_size) * (base - 1)^2 exactly. Returns 0 if the
+             *          product is too long for the transform or the coefficients for the primes.
+             */
+            template <typename T>
+            int ntt_primes_needed(size_t a_size, size_t b_size, T base) {
+                if (a_size == 0 || b_size == 0) {
+                    return 0;
+                }
+                size_t length = 1;
+                int log_length = 0;
+                while (length < a_size + b_size - 1) {
+                    length <<= 1;
+                    log_length++;
+                }
+
+                const double coefficient_bits = std::log2((double) std::min(a_size, b_size)) + 2 * std::log2((double) base) + 1;
+                double modulus_bits = 0;
+                for (int m = 0; m < NTT_PRIME_COUNT; ++m) {
+                    if (log_length > ntt_max_log_lengths[m]) {
+                        return 0;
+                    }
+                    modulus_bits += std::log2((double) ntt_moduli[m]);
+                    if (modulus_bits > coefficient_bits) {
+                        return m + 1;
+                    }
+                }
+                return 0;
+            }
+
+            /**
+             *  @brief: multiplies two integers given as digit vectors (most significant digit first) with
+             *          number theoretic transforms modulo primes moduli. Every coefficient of the product
+             *          is rebuilt from its residues with Garner's algorithm into 32 bit words and the carries
+             *          are propagated in the given base, dividing the words by the base with the wide type
+             *          of the limbs.
+             *  @param: a, b: the factors, a == b may be used for squares
+             *  @param: base: base of the digits
+             *  @param: primes: number of primes, as returned by ntt_primes_needed
+             *  @return: the a.size() + b.size() digits of the product, most significant digit first
+             */
+            template <typename T>
+            std::vector<T> ntt_multiply(const std::vector<T> &a, const std::vector<T> &b, T base, int primes) {
+                static_assert(ntt_supports_limb<T>(), "ntt_multiply needs a wide type to propagate carries");
+                using wide_type = typename limb_traits<T>::wide_type;
+                constexpr int WORDS = NTT_PRIME_COUNT + 1;
+
+                const size_t product_size = a.size() + b.size() - 1;
+                size_t length = 1;
+                while (length < product_size) {
+                    length <<= 1;
+                }
+
+                const bool square = (&a == &b);
+                std::vector<std::vector<uint32_t>> residues(primes);
+                for (int m = 0; m < primes; ++m) {
+                    residues[m] = ntt_convolution(m, a, b, length, square);
+                }
+
+                // inverses[j][i] = p_j^-1 mod p_i, for j < i
+                std::array<std::array<uint32_t, NTT_PRIME_COUNT>, NTT_PRIME_COUNT> inverses {};
+                for (int i = 0; i < primes; ++i) {
+                    for (int j = 0; j < i; ++j) {
+                        inverses[j][i] = pow_mod(ntt_moduli[j] % ntt_moduli[i], ntt_moduli[i] - 2, ntt_moduli[i]);
+                    }
+                }
+
+                // a coefficient is lower than the product of the primes, below 2^(31 * primes), and the carry
+                // is lower than min(a.size(), b.size()) * base, below 2^96
+                const int words = std::max(primes, 3) + 1;
+
+                // digit k of the product collects the coefficient k - 1, digit 0 only receives the last carry
+                std::vector<T> result(product_size + 1, 0);
+                std::array<uint32_t, WORDS> carry {};
+                for (size_t k = product_size; k-- > 0;) {
+                    // Garner: coefficient = x_0 + p_0 * (x_1 + p_1 * (x_2 + ...)), with x_i < p_i
+                    std::array<uint32_t, NTT_PRIME_COUNT> x {};
+                    for (int i = 0; i < primes; ++i) {
+                        uint64_t v = residues[i][k];
+                        for (int j = 0; j < i; ++j) {
+                            v = (v + ntt_moduli[i] - x[j] % ntt_moduli[i]) * inverses[j][i] % ntt_moduli[i];
+                        }
+                        x[i] = (uint32_t) v;
+                    }
+
+                    std::array<uint32_t, WORDS> total {};
+                    for (int i = primes - 1; i >= 0; --i) {
+                        uint64_t c = x[i];
+                        for (int w = 0; w < words; ++w) {
+                            uint64_t t = (uint64_t) total[w] * ntt_moduli[i] + c;
+                            total[w] = (uint32_t) t;
+                            c = t >> 32;
+                        }
+                    }
+
+                    uint64_t c = 0;
+                    for (int w = 0; w < words; ++w) {
+                        uint64_t t = (uint64_t) total[w] + carry[w] + c;
+                        total[w] = (uint32_t) t;
+                        c = t >> 32;
+                    }
+
+                    // digit = total % base, carry = total / base
+                    wide_type rem = 0;
+                    for (int w = words; w-- > 0;) {
+                        wide_type cur = (rem << 32) | total[w];
+                        carry[w] = (uint32_t) (cur / (wide_type) base);
+                        rem = cur % (wide_type) base;
+                    }
+                    result[k + 1] = (T) rem;
+                }
+
+                wide_type top = 0;
+                for (int w = words; w-- > 0;) {
+                    top = (top << 32) | carry[w];
+                }
+                result[0] = (T) top;
+                return result;
+            }
+        }
+    }
+}
+
+#endif // BOOST_REAL_NTT_HPP
@@ -73,6 +73,48 @@ namespace boost {
             // ctor from shared_ptr to (already init) real_data. used in check_and_distribute.
             real(std::shared_ptr<real_data<T>> x) : _real_p(x){};
 
+            /**
+             * @brief: the n-th root of number when it is exact, that is when number is an integer, or a rational
+             *         a/b, whose parts are n-th powers. The roots are taken by iroot, the first of the pair tells
+             *         whether there is an exact root.
+             */
+            static std::pair<bool, real> exact_root(const real &number, unsigned int n) {
+                const real_number<T> &value = number._real_p->get_real_number();
+                if (const real_rational<T> *rational = std::get_if<real_rational<T>>(&value)) {
+                    real_rational<T> reduced = *rational;
+                    reduced.normalize();
+                    if (!reduced.positive && n % 2 == 0) {
+                        return std::make_pair(false, number);
+                    }
+                    integer_number<T> a = iroot(reduced.a, n), b = iroot(reduced.b, n);
+                    if (ipow(a, n) != reduced.a || ipow(b, n) != reduced.b) {
+                        return std::make_pair(false, number);
+                    }
+                    a.positive = reduced.positive;
+                    return std::make_pair(true, real(std::make_shared<real_data<T>>(real_rational<T>(a, b))));
+                }
+
+                if (const real_explicit<T> *explicit_number = std::get_if<real_explicit<T>>(&value)) {
+                    exact_number<T> x = explicit_number->get_exact_number();
+                    const bool zero = std::all_of(x.digits.begin(), x.digits.end(), [](T digit) { return digit == 0; });
+                    x.normalize();
+                    // a number with fraction limbs takes the general path
+                    if (!zero && (x.exponent < (int) x.digits.size() || (!x.positive && n % 2 == 0))) {
+                        return std::make_pair(false, number);
+                    }
+                    integer_number<T> magnitude(x);
+                    magnitude.positive = true;
+                    const integer_number<T> root = iroot(magnitude, n);
+                    if (ipow(root, n) != magnitude) {
+                        return std::make_pair(false, number);
+                    }
+                    exact_number<T> result = root.to_exact_number();
+                    result.positive = x.positive || zero;
+                    return std::make_pair(true, real(real_explicit<T>(std::move(result))));
+                }
+                return std::make_pair(false, number);
+            }
+
         public:
             /// @TODO: Move constructors to move directly from the ctors in real_explicit to the values in real_data
             /// @TODO: do we need different ctors to be more efficient? rvalue AND lvalue ref?
@@ -124,7 +166,7 @@ namespace boost {
                 }
                 if(type=="integer"){
                     integer_number<T> a(number);
-                    integer_number<T> b("1");
+                    integer_number<T> b(1);
                     this->_real_p = std::make_shared<real_data<T>>(real_rational<T>(a,b));
                 }
                 if(type=="rational"){
@@ -162,7 +204,7 @@ namespace boost {
                 
                     case TYPE::INTEGER:{
                         integer_number<T> a(number);
-                        integer_number<T> b("1");
+                        integer_number<T> b(1);
                         this->_real_p = std::make_shared<real_data<T>>(real_rational<T>(a,b));
                         break;
                     }
@@ -464,7 +506,7 @@ namespace boost {
                                 return std::make_pair(false, std::nullopt);
                             }
 
-                            real<T> one ("1");
+                            real<T> one({1}, 1);
                             real<T> x_op_1;
 
                             if(op == OPERATION::ADDITION) {
@@ -516,7 +558,7 @@ namespace boost {
                         }
 
                         real<T> x_op_1;
-                        real<T> one ("1");
+                        real<T> one({1}, 1);
 
                         if(op == OPERATION::ADDITION) {
                             switch(rc_lvl) {
@@ -554,7 +596,7 @@ namespace boost {
                     }
                 } else { // neither is an operation
                     if ((this->_real_p == other._real_p) && (op == OPERATION::ADDITION)) { // a + a = 2 * a
-                        std::shared_ptr<real_data<T>> two = std::make_shared<real_data<T>>(real_explicit<T>("2"));
+                        std::shared_ptr<real_data<T>> two = std::make_shared<real_data<T>>(real_explicit<T>({2}, 1));
 
                         if(assign_and_return_void) {
                             this->_real_p = std::make_shared<real_data<T>>(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION));
@@ -617,7 +659,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real exp(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::EXPONENT));
             }
 
@@ -629,7 +671,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real log(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
             }
 
@@ -641,8 +683,8 @@ namespace boost {
              * @author: Suraj Nehra
              **/
             static real log10(real<T> real_num){
-                static real<T> zero("0");
-                static real<T> ten("10");
+                static real<T> zero({0}, 0);
+                static real<T> ten({10}, 1);
                 // log x (base 10) = lnx/ln10 or (log x (base e))/ (log 10 (base e))
                 // Errors related to non-positive numbers will be handled by log function which we are calling in this function.
                 real<T> logx = real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
@@ -659,15 +701,31 @@ namespace boost {
              */
             static real power(real<T> real_num, real<T> power){
                 // checking whether the number is integer or not
-                static real<T> zero("0");
-                static real<T> one("1");
+                static real<T> zero({0}, 0);
+                static real<T> one({1}, 1);
                 real<T> result;
 
+                // the power 1/n of an integer or rational with an exact n-th root is that root
+                if (const real_rational<T> *exponent = std::get_if<real_rational<T>>(&power._real_p->get_real_number())) {
+                    real_rational<T> index = *exponent;
+                    index.normalize();
+                    if (index.positive && index.a == literals::one_integer<T> &&
+                        index.b.digits.size() <= (size_t) detail::lehmer_limbs<T>()) {
+                        const unsigned long long n = detail::limbs_value(index.b.digits, 0, index.b.digits.size());
+                        if (n >= 2 && n <= std::numeric_limits<unsigned int>::max()) {
+                            const std::pair<bool, real> root = exact_root(real_num, (unsigned int) n);
+                            if (root.first) {
+                                return root.second;
+                            }
+                        }
+                    }
+                }
+
                 try{
                     result = real(real_operation<T>(real_num._real_p, power._real_p, OPERATION::INTEGER_POWER));
                 }
                 catch(const negative_integers_not_supported& e1){
-                    power = real<T>("-1")*power;
+                    power = real<T>({1}, 1, false)*power;
                     result = real(real_operation<T>(real_num._real_p, power._real_p, OPERATION::INTEGER_POWER));
                     result = real(real_operation<T>(one._real_p, result._real_p, OPERATION::DIVISION));
                 }
@@ -704,8 +762,13 @@ namespace boost {
              */
 
             static real sqrt(real<T> real_num){
-                real<T> power("1/2", TYPE::RATIONAL);
-                real<T> zero("0");
+                static real<T> power(std::make_shared<real_data<T>>(real_rational<T>(integer_number<T>(1), integer_number<T>(2))));
+                static real<T> zero({0}, 0);
+                // the square root of an integer or rational square is exact, iroot takes it in a few products
+                const std::pair<bool, real> root = exact_root(real_num, 2);
+                if (root.first) {
+                    return root.second;
+                }
                 real<T> result;
                 try{
                     result = real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::LOGARITHM));
@@ -727,7 +790,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real sin(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::SIN));
             }
 
@@ -739,7 +802,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real cos(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COS));
             }
 
@@ -752,7 +815,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real tan(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::TAN));
             }
 
@@ -764,7 +827,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real cot(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COT));
             }
 
@@ -776,7 +839,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real sec(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::SEC));
             }
 
@@ -788,7 +851,7 @@ namespace boost {
              * @author: Vikram Singh Chundawat
              **/
             static real cosec(real<T> real_num){
-                static real<T> zero("0");
+                static real<T> zero({0}, 0);
                 return real(real_operation<T>(real_num._real_p, zero._real_p, OPERATION::COSEC));
             }
 
@@ -1954,11 +2017,14 @@ namespace boost {
         void to_explicit(){
             std::visit(overloaded{
                 [this] (real_rational<T> a){
-                    if(a.b!=literals::one_rational<T>){
+                    a.normalize();
+                    if(a.b!=literals::one_integer<T>){
                         throw expected_real_integer_type_number();
                     }
+                    exact_number<T> number = a.a.to_exact_number();
+                    number.positive = a.positive || a.a == literals::zero_integer<T>;
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_explicit<T>(a.a));
+                        std::make_shared<real_data<T>>(real_explicit<T>(std::move(number)));
                 },
                 [] (auto a){
                     throw expected_real_integer_type_number();
@@ -2012,10 +2078,10 @@ namespace boost {
 
         namespace literals{
             template<typename T>
-            const real<T> one_real = real<T>("1");
+            const real<T> one_real = real<T>({1}, 1);
 
             template<typename T>
-            const real<T> one_zero = real<T>("0");
+            const real<T> one_zero = real<T>({0}, 0);
         }
     }
 }
@@ -55,6 +55,7 @@ namespace boost {
 
         /* const_precision_iterator member functions */
         /// determines a real_operation's approximation interval from its operands'
+        /// the bounds truncated by up_to are temporaries, so the operators compute in them without copies
         template <typename T>
         inline void const_precision_iterator<T>::update_operation_boundaries(real_operation<T> &ro) {
             switch (ro.get_operation()) {
@@ -80,101 +81,78 @@ namespace boost {
                     break;
 
                 case OPERATION::MULTIPLICATION: {
-                    bool lhs_positive = ro.get_lhs_itr().get_interval().positive();
-                    bool rhs_positive = ro.get_rhs_itr().get_interval().positive();
-                    bool lhs_negative = ro.get_lhs_itr().get_interval().negative();
-                    bool rhs_negative = ro.get_rhs_itr().get_interval().negative();
+                    /* bounds of at most _precision digits are multiplied exactly, so exact operands keep
+                     * an exact product. Longer ones go through multiply_truncated, which computes only the
+                     * top digits of the product and rounds it to _precision digits towards the bound's side */
+                    const interval<T> &lhs = ro.get_lhs_itr().get_interval();
+                    const interval<T> &rhs = ro.get_rhs_itr().get_interval();
+                    auto multiply_truncated = [](const exact_number<T> &x, const exact_number<T> &y, size_t precision, bool upper) {
+                        if (x.digits.size() <= precision && y.digits.size() <= precision) {
+                            return x * y;
+                        }
+                        return boost::real::multiply_truncated(x, y, precision, upper);
+                    };
+                    bool lhs_positive = lhs.positive();
+                    bool rhs_positive = rhs.positive();
+                    bool lhs_negative = lhs.negative();
+                    bool rhs_negative = rhs.negative();
 
                     if (lhs_positive && rhs_positive) { // Positive - Positive
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                multiply_truncated(lhs.lower_bound, rhs.lower_bound, _precision, false);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                multiply_truncated(lhs.upper_bound, rhs.upper_bound, _precision, true);
 
                     } else if (lhs_negative && rhs_negative) { // Negative - Negative
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                multiply_truncated(lhs.upper_bound, rhs.upper_bound, _precision, false);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                multiply_truncated(lhs.lower_bound, rhs.lower_bound, _precision, true);
                     } else if (lhs_negative && rhs_positive) { // Negative - Positive
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                multiply_truncated(lhs.lower_bound, rhs.upper_bound, _precision, false);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                multiply_truncated(lhs.upper_bound, rhs.lower_bound, _precision, true);
 
                     } else if (lhs_positive && rhs_negative) { // Positive - Negative
                         this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                multiply_truncated(lhs.upper_bound, rhs.lower_bound, _precision, false);
 
                         this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                multiply_truncated(lhs.lower_bound, rhs.upper_bound, _precision, true);
 
                     } else { // One is around zero all possible combinations are be tested
-
-                        exact_number<T> current_boundary;
-
                         // Lower * Lower
-                        current_boundary =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-
-                        this->_approximation_interval.lower_bound = current_boundary;
-                        this->_approximation_interval.upper_bound = current_boundary;
-
-                        // Upper * upper
-                        current_boundary =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
-                        if (current_boundary < this->_approximation_interval.lower_bound) {
-                            this->_approximation_interval.lower_bound.up_to(_precision, false) = current_boundary;
-                        }
-
-                        if (this->_approximation_interval.upper_bound < current_boundary) {
-                            this->_approximation_interval.upper_bound = current_boundary;
-                        }
-
-                        // Lower * upper
-                        current_boundary =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-
-                        if (current_boundary < this->_approximation_interval.lower_bound.up_to(_precision, false)) {
-                            this->_approximation_interval.lower_bound = current_boundary;
-                        }
-
-                        if (this->_approximation_interval.upper_bound < current_boundary) {
-                            this->_approximation_interval.upper_bound = current_boundary;
-                        }
-
-                        // Upper * lower
-                        current_boundary =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        this->_approximation_interval.lower_bound =
+                                multiply_truncated(lhs.lower_bound, rhs.lower_bound, _precision, false);
+                        this->_approximation_interval.upper_bound =
+                                multiply_truncated(lhs.lower_bound, rhs.lower_bound, _precision, true);
 
-                        if (current_boundary < this->_approximation_interval.lower_bound.up_to(_precision, false)) {
-                            this->_approximation_interval.lower_bound = current_boundary;
-                        }
+                        // Upper * upper, Lower * upper and Upper * lower
+                        const std::pair<const exact_number<T> *, const exact_number<T> *> products[] = {
+                                {&lhs.upper_bound, &rhs.upper_bound},
+                                {&lhs.lower_bound, &rhs.upper_bound},
+                                {&lhs.upper_bound, &rhs.lower_bound}
+                        };
+                        for (const auto &[x, y] : products) {
+                            exact_number<T> current_boundary = multiply_truncated(*x, *y, _precision, false);
+                            if (current_boundary < this->_approximation_interval.lower_bound) {
+                                this->_approximation_interval.lower_bound = std::move(current_boundary);
+                            }
 
-                        if (this->_approximation_interval.upper_bound < current_boundary) {
-                            this->_approximation_interval.upper_bound = current_boundary;
+                            current_boundary = multiply_truncated(*x, *y, _precision, true);
+                            if (this->_approximation_interval.upper_bound < current_boundary) {
+                                this->_approximation_interval.upper_bound = std::move(current_boundary);
+                            }
                         }
                     }
                     break;
                 }
                 case OPERATION::DIVISION: {
-                    T base = (std::numeric_limits<T>::max() / 4) * 2 - 1;
+                    T base = limb_traits<T>::max_digit;
                     exact_number<T> zero = exact_number<T>();
                     exact_number<T> residual;
                     exact_number<T> quotient;
@@ -230,10 +208,10 @@ namespace boost {
                         }
                     }
 
-                    quotient = numerator;
+                    quotient = std::move(numerator);
                     quotient.divide_vector(denominator, this->_precision, deviation_upper_boundary);
 
-                    this->_approximation_interval.upper_bound = quotient;
+                    this->_approximation_interval.upper_bound = std::move(quotient);
 
                     /* Lower Boundary */
                     if (ro.get_lhs_itr().get_interval().positive()) {
@@ -268,10 +246,10 @@ namespace boost {
                         }
                     }
 
-                    quotient = numerator;
+                    quotient = std::move(numerator);
                     quotient.divide_vector(denominator, this->_precision, deviation_lower_boundary );
 
-                    this->_approximation_interval.lower_bound = quotient;
+                    this->_approximation_interval.lower_bound = std::move(quotient);
 
                     break;
                 }
@@ -287,23 +265,12 @@ namespace boost {
                         throw negative_integers_not_supported();
                     }
 
-                    exact_number<T> exponent = ro.get_rhs_itr().get_interval().upper_bound, _2, zero = exact_number<T> (), tmp;
-                    _2.digits = {2};
-                    _2.exponent = 1;
-
-                    std::vector<T> exponent_vector, quotient, remainder;
-                    exponent_vector = exponent.digits;
-                    while ((int) exponent_vector.size() < exponent.exponent) {
-                        exponent_vector.push_back(0);
-                    }
-
-                    tmp.division_by_single_digit(exponent_vector, std::vector<T> {2}, quotient, remainder);
-
-                    bool exponent_is_even = false;
+                    exact_number<T> exponent = ro.get_rhs_itr().get_interval().upper_bound, zero = exact_number<T> (), tmp;
 
-                    if (remainder.empty()) {
-                        exponent_is_even = true;
-                    }
+                    // the base is even, so the integer exponent has the parity of its units digit
+                    bool exponent_is_even = exponent.exponent > (int) exponent.digits.size() ||
+                                            exponent.exponent <= 0 ||
+                                            exponent.digits[exponent.exponent - 1] % 2 == 0;
 
                     if (ro.get_lhs_itr().get_interval().positive()) {
                         this->_approximation_interval.upper_bound = 
@@ -416,7 +383,7 @@ namespace boost {
                          **/
                         else{
                             auto mid = ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) + ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
+                            mid.scale_by_power_of_two(-1);
                             if(sin_lower.positive == sin_upper.positive 
                                 && sine(mid, _precision, true).positive == sin_upper.positive){
                                 this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
@@ -454,7 +421,7 @@ namespace boost {
                         if(cos_upper.positive == cos_lower.positive){
                              // if sign of derivative at mid point is not same as at end points then both minima and maxima are there
                             auto mid = ro.get_lhs_itr().get_interval().upper_bound + ro.get_lhs_itr().get_interval().lower_bound;
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
+                            mid.scale_by_power_of_two(-1);
                             if(cosine(mid, _precision, true).positive != cos_lower.positive){
                                 this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
                                 this->_approximation_interval.upper_bound = literals::one_exact<T>;
@@ -531,7 +498,7 @@ namespace boost {
                          **/
                         else{
                             auto mid = ro.get_lhs_itr().get_interval().upper_bound + ro.get_lhs_itr().get_interval().lower_bound;
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
+                            mid.scale_by_power_of_two(-1);
                             if(cos_lower.positive == cos_upper.positive 
                                 && cosine(mid, _precision, true).positive == cos_upper.positive){
                                 this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
@@ -568,7 +535,7 @@ namespace boost {
                         if(sin_upper.positive == sin_lower.positive){
                             // if sign of derivative at mid point is not same as at end points then both minima and maxima are there
                             auto mid = ro.get_lhs_itr().get_interval().upper_bound + ro.get_lhs_itr().get_interval().lower_bound;
-                            mid.divide_vector(literals::two_exact<T>, _precision, true);
+                            mid.scale_by_power_of_two(-1);
                             if(sine(mid, _precision, true).positive != sin_lower.positive){
                                 this->_approximation_interval.lower_bound = literals::minus_one_exact<T>;
                                 this->_approximation_interval.upper_bound = literals::one_exact<T>;
@@ -632,7 +599,7 @@ namespace boost {
                              **/
                             else{
                                 auto mid = ro.get_lhs_itr().get_interval().lower_bound + ro.get_lhs_itr().get_interval().upper_bound;
-                                mid.divide_vector(literals::two_exact<T>, _precision, true);
+                                mid.scale_by_power_of_two(-1);
                                 if(cosine(mid, _precision, true).positive != cos_lower_tmp.positive){
                                     iterate_again = true;
                                 }
@@ -691,7 +658,7 @@ namespace boost {
                              **/
                             else{
                                 auto mid = ro.get_lhs_itr().get_interval().lower_bound + ro.get_lhs_itr().get_interval().upper_bound;
-                                mid.divide_vector(literals::two_exact<T>, _precision, true);
+                                mid.scale_by_power_of_two(-1);
                                 if(sine(mid, _precision, true).positive != sin_lower_tmp.positive){
                                     iterate_again = true;
                                 }
@@ -752,7 +719,7 @@ namespace boost {
                              **/
                             else{
                                 auto mid = ro.get_lhs_itr().get_interval().lower_bound + ro.get_lhs_itr().get_interval().upper_bound;
-                                mid.divide_vector(literals::two_exact<T>, _precision, true);
+                                mid.scale_by_power_of_two(-1);
                                 if(cosine(mid, _precision, true).positive != cos_lower_tmp.positive){
                                     iterate_again = true;
                                 }
@@ -790,8 +757,8 @@ namespace boost {
                     if(derivative_lower.positive != derivative_upper.positive){
                         // if minima exists and either number is positive, then lower end of resulting interval is 1
                         if(cos_upper.positive){
-                            this->_approximation_interval.lower_bound = exact_number<T>("1");
-                            this->_approximation_interval.upper_bound = exact_number<T>("1");
+                            this->_approximation_interval.lower_bound = literals::one_exact<T>;
+                            this->_approximation_interval.upper_bound = literals::one_exact<T>;
                             if(cos_upper > cos_lower){
                                 this->_approximation_interval.upper_bound.divide_vector(cos_lower, _precision, true);
                             }
@@ -800,8 +767,8 @@ namespace boost {
                             }
                         }
                         else{
-                            this->_approximation_interval.upper_bound = exact_number<T>("-1");
-                            this->_approximation_interval.lower_bound = exact_number<T>("1");
+                            this->_approximation_interval.upper_bound = literals::minus_one_exact<T>;
+                            this->_approximation_interval.lower_bound = literals::one_exact<T>;
                             if(cos_upper > cos_lower){
                                 this->_approximation_interval.upper_bound.divide_vector(cos_lower, _precision, true);
                             }
@@ -812,8 +779,8 @@ namespace boost {
                         }
                     }
                     else{
-                        this->_approximation_interval.upper_bound = exact_number<T>("1");
-                        this->_approximation_interval.lower_bound = exact_number<T>("1");
+                        this->_approximation_interval.upper_bound = literals::one_exact<T>;
+                        this->_approximation_interval.lower_bound = literals::one_exact<T>;
                         if(cos_upper > cos_lower){
                             this->_approximation_interval.lower_bound.divide_vector(cos_upper, _precision, false);
                             this->_approximation_interval.upper_bound.divide_vector(cos_lower, _precision, true);
@@ -853,7 +820,7 @@ namespace boost {
                              **/
                             else{
                                 auto mid = ro.get_lhs_itr().get_interval().lower_bound + ro.get_lhs_itr().get_interval().upper_bound;
-                                mid.divide_vector(literals::two_exact<T>, _precision, true);
+                                mid.scale_by_power_of_two(-1);
                                 if(sine(mid, _precision, true).positive != sin_lower_tmp.positive){
                                     iterate_again = true;
                                 }
@@ -891,8 +858,8 @@ namespace boost {
                     if(derivative_lower.positive != derivative_upper.positive){
                         // if minima exists and either number is positive, then lower end of resulting interval is 1
                         if(sin_upper.positive){
-                            this->_approximation_interval.lower_bound = exact_number<T>("1");
-                            this->_approximation_interval.upper_bound = exact_number<T>("1");
+                            this->_approximation_interval.lower_bound = literals::one_exact<T>;
+                            this->_approximation_interval.upper_bound = literals::one_exact<T>;
                             if(sin_upper > sin_lower){
                                 this->_approximation_interval.upper_bound.divide_vector(sin_lower, _precision, true);
                             }
@@ -901,8 +868,8 @@ namespace boost {
                             }
                         }
                         else{
-                            this->_approximation_interval.upper_bound = exact_number<T>("-1");
-                            this->_approximation_interval.lower_bound = exact_number<T>("1");
+                            this->_approximation_interval.upper_bound = literals::minus_one_exact<T>;
+                            this->_approximation_interval.lower_bound = literals::one_exact<T>;
                             if(sin_upper > sin_lower){
                                 this->_approximation_interval.upper_bound.divide_vector(sin_lower, _precision, false);
                             }
@@ -913,8 +880,8 @@ namespace boost {
                         }
                     }
                     else{
-                        this->_approximation_interval.upper_bound = exact_number<T>("1");
-                        this->_approximation_interval.lower_bound = exact_number<T>("1");
+                        this->_approximation_interval.upper_bound = literals::one_exact<T>;
+                        this->_approximation_interval.lower_bound = literals::one_exact<T>;
                         if(sin_upper > sin_lower){
                             this->_approximation_interval.lower_bound.divide_vector(sin_upper, _precision, false);
                             this->_approximation_interval.upper_bound.divide_vector(sin_lower, _precision, true);
@@ -46,66 +46,13 @@ namespace boost {
             real_explicit<T>(const real_explicit<T>& other)  = default;
 
             constexpr explicit real_explicit(const std::string_view integer_part, const std::string_view decimal_part, int exponent, bool positive) {
-                exact_number<T> op;
                 explicit_number.positive = positive;
                 if (integer_part.empty() && decimal_part.empty()) {
                     explicit_number.digits = {0};
                     explicit_number.exponent = 0;
                     return;
                 }
-                explicit_number.exponent = exponent;
-                for (const auto& c : integer_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                for (const auto& c : decimal_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                //changing base below
-                exponent = 0;
-                //int b = 30;
-                T b = (std::numeric_limits<T>::max() /4)*2;
-                std::vector<T> base;
-                while (b!=0) {
-                    base.push_back(b%10);
-                    b /= 10;
-                }
-                std::reverse(base.begin(), base.end());
-                int curr_size = explicit_number.digits.size();
-                
-                for (int i = 0; i<explicit_number.exponent-curr_size; ++i) {
-                    explicit_number.digits.push_back(0);
-                }
-                
-                while (explicit_number.digits.size() > 1) {
-                    std::vector<T> quotient;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient, 10);
-                    if (rem.empty()) {
-                        explicit_number.digits = quotient;
-                        ++exponent; 
-                    }
-                    else
-                        break;
-                }
-                
-                std::vector<T> new_digits;
-                while (!explicit_number.digits.empty()) {
-                    std::vector<T> quotient;
-                    //std::vector<T> rem;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient, 10);
-                    T result = 0;
-                    for (auto d : rem)  
-                    {
-                        result = result * 10 + d;
-                    }
-                    
-                    new_digits.push_back(result);
-                    explicit_number.digits = quotient;
-                }
-                
-                std::reverse (new_digits.begin(), new_digits.end());
-                exponent += (int)new_digits.size();
-                explicit_number.digits = new_digits;
-                explicit_number.exponent = exponent;
+                explicit_number = exact_number<T>::integer_from_decimal(integer_part, decimal_part, exponent, positive);
             }
             
             constexpr explicit real_explicit(std::string_view number) {
@@ -116,93 +63,15 @@ namespace boost {
                     explicit_number.exponent = 0;
                     return;
                 }
-                exact_number<T> op;
-                explicit_number.exponent = exponent;
-                for (const auto& c : integer_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                for (const auto& c : decimal_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                explicit_number.positive = positive;
-
-                //changing base below.
-                exponent = 0;
-                T b = (std::numeric_limits<T>::max() /4)*2;
-                std::vector<T> base;
-                while (b!=0) {
-                    base.push_back(b%10);
-                    b /= 10;
-                }
-                std::reverse(base.begin(), base.end());
-                int curr_size = explicit_number.digits.size();
-                
-                for (int i = 0; i<explicit_number.exponent-curr_size; ++i) {
-                    explicit_number.digits.push_back(0);
-                }
-                
-                while (explicit_number.digits.size() > 1) {
-                    std::vector<T> quotient;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient, 10);
-                    if (rem.empty()) {
-                        explicit_number.digits = quotient;
-                        ++exponent; 
-                    }
-                    else
-                        break;
-                }
-                
-                std::vector<T> new_digits;
-                while (!explicit_number.digits.empty()) {
-                    std::vector<T> quotient;
-                    //std::vector<T> rem;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient, 10);
-                    T result = 0;
-                    for (auto d : rem)  
-                    {
-                        result = result * 10 + d;
-                    }
-                    
-                    new_digits.push_back(result);
-                    explicit_number.digits = quotient;
-                }
-                
-                std::reverse (new_digits.begin(), new_digits.end());
-                exponent += (int)new_digits.size();
-                explicit_number.digits = new_digits;
-                explicit_number.exponent = exponent;
-               
+                explicit_number = exact_number<T>::integer_from_decimal(integer_part, decimal_part, exponent, positive);
             }
 
-            // constructor to convert an integer type rational number into an explicit number
-            constexpr explicit real_explicit(integer_number<T> num){
-                int _exponent = 0;
-                std::vector<T> num_vector = num.digits;
-                size_t n = num_vector.size();
-                if(n==0) return;
-                for(size_t i=n-1;true;--i){
-                    if(num_vector[i]==0){
-                        _exponent++;
-                        num_vector.pop_back();
-                    }
-                    else break;
-                    if(i==0){
-                        // this means all digits were zero, 
-                        // generally, this condition should not occur, but if occured, then 
-                        explicit_number.exponent  =0;
-                        explicit_number.digits = {0};
-                        explicit_number.positive = true;
-                        return;
-                    }
-                }
-            
-                _exponent += num_vector.size();
-                explicit_number.digits = num_vector;
-                explicit_number.exponent = _exponent;
-                explicit_number.positive = num.positive;
+            // constructor from an exact_number, its limb buffer is moved into the number
+            explicit real_explicit(exact_number<T> number) : explicit_number(std::move(number)) {}
 
-                return;
-            }           
+            // constructor to convert an integer type rational number into an explicit number, both keep
+            // limbs of the same base, so they are copied over without a conversion
+            explicit real_explicit(const integer_number<T> &num) : real_explicit(num.to_exact_number()) {}           
 
             /**
              * @brief *Initializer list constructor with exponent:* Creates a boost::real::real_explicit
@@ -249,7 +118,7 @@ namespace boost {
             /**
              * @return a const reference to the vector holding the number digits
              */
-            const std::vector<T>& digits() const {
+            const typename exact_number<T>::digits_type& digits() const {
                 return explicit_number.digits;
             }
 
@@ -296,10 +165,10 @@ namespace boost {
 
         namespace literals{
             template<typename T>
-            const real_explicit<T> zero_explicit = real_explicit<T>("0");
+            const real_explicit<T> zero_explicit = real_explicit<T>({0}, 0);
 
             template<typename T>
-            const real_explicit<T> one_explicit = real_explicit<T>("1");
+            const real_explicit<T> one_explicit = real_explicit<T>({1}, 1);
         }
     }
 }
@@ -7,6 +7,54 @@
 
 namespace boost{
 	namespace real{
+		namespace detail{
+			/**
+			 * @brief: BINARY SPLITTING of the exponential series, the sum over k in [n1, n2) of
+			 *         x^(k - n1 + 1) / (n1 * ... * k) as t / q, with p = x^(n2 - n1) and q = n1 * ... * (n2 - 1).
+			 *         Both halves are split again, so the products are balanced and the large ones go
+			 *         through the fast multiplication tiers instead of one term at a time
+			 **/
+			template<typename T>
+			void exponent_binary_splitting(const exact_number<T> &x, T n1, T n2, exact_number<T> &p, exact_number<T> &q, exact_number<T> &t){
+				if(n2 - n1 == 1){
+					p = x;
+					q = exact_number<T>(n1);
+					t = x;
+					return;
+				}
+				const T mid = n1 + (n2 - n1) / 2;
+				exact_number<T> p_right, q_right, t_right;
+				exponent_binary_splitting(x, n1, mid, p, q, t);
+				exponent_binary_splitting(x, mid, n2, p_right, q_right, t_right);
+				// t / q + (p / q) * (t_right / q_right), p * t_right accumulated into t in place
+				t *= q_right;
+				fma(t, p, t_right);
+				p *= p_right;
+				q *= q_right;
+			}
+
+			/**
+			 * @brief: the number of terms n of the exponential series of x for which |x|^n / n! is below a
+			 *         quarter of base^(-max_error_exponent), with n > 2|x| so that the terms at least halve
+			 *         from there on. 0 if |x| is too large for the series to be summed at once
+			 **/
+			template<typename T>
+			T exponent_series_length(const exact_number<T> &x, size_t max_error_exponent){
+				const double log_base = std::log((double) limb_traits<T>::base);
+				// an upper bound of log|x| from the leading digit
+				const double log_x = std::log((double) x.digits.front() + 1) + (x.exponent - 1) * log_base;
+				if(log_x > 16){
+					return 0;
+				}
+				const double log_error = -(double) max_error_exponent * log_base - std::log(4.0);
+				double n = std::max(2.0, std::floor(2 * std::exp(log_x)) + 1);
+				while(n * log_x - std::lgamma(n + 1) >= log_error){
+					++n;
+				}
+				return n < (double) limb_traits<T>::max_digit ? (T) n : 0;
+			}
+		}
+
 		/**
 		 *  EXPONENT FUNCTION USING TAYLOR EXPANSION
 		 * @brief: calculates exponent of a exact_number using taylor expansion
@@ -18,20 +66,50 @@ namespace boost{
 		 **/
 		template<typename T>
 		exact_number<T> exponent(exact_number<T> num, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
-			exact_number<T> term_number("1");
-			exact_number<T> factorial("1");
-			exact_number<T> cur_term("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			exact_number<T> x_pow("1");
+			exact_number<T> max_error({1}, -(int) max_error_exponent);
+			// at a high precision, the terms before the one below max_error are summed by binary splitting
+			// and divided once
+			const T length = (num.is_zero() || max_error_exponent < (size_t) algorithm_thresholds<T>::get().binary_splitting)
+				? 0 : detail::exponent_series_length(num, max_error_exponent);
+			if(length > 1){
+				exact_number<T> p, q, result;
+				detail::exponent_binary_splitting(num, (T) 1, length, p, q, result);
+				result.divide_vector(q, max_error_exponent, upper == result.positive);
+				result += literals::one_exact<T>;
+				// the tail past the last term is below max_error / 4, and the division is rounded towards
+				// the requested side
+				if(upper){
+					result += max_error;
+				}else{
+					result -= max_error;
+				}
+				return result.up_to(max_error_exponent, upper);
+			}
+
+			exact_number<T> result = literals::one_exact<T>;
+			T term_number = 1;
+			exact_number<T> factorial = literals::one_exact<T>;
+			exact_number<T> cur_term = literals::zero_exact<T>;
+			exact_number<T> x_pow = literals::one_exact<T>;
 			do{
 				result += cur_term;
-				factorial *= term_number;
-				term_number = term_number + literals::one_exact<T>;
+				factorial.multiply_by_small(term_number);
+				++term_number;
 				x_pow *= num;
 				cur_term = x_pow;
-				cur_term.divide_vector(factorial, max_error_exponent, upper);
-			}while(cur_term.abs() > max_error);
+				// divide_vector rounds the magnitude, a negative term rounds towards the requested side with
+				// its magnitude rounded the other way
+				cur_term.divide_vector(factorial, max_error_exponent, upper == cur_term.positive);
+			}while(exact_number<T>::abs_is_lower(max_error, cur_term));
+			// the terms are rounded towards the requested side, the tail of the series is not. Past the
+			// last term it is below max_error for a negative num, whose terms alternate, and below
+			// 2 * max_error for a positive one, whose terms at least halve from there on. exp(0) has none
+			if (upper && !num.is_zero()) {
+				result += max_error;
+				result += max_error;
+			} else if (!num.is_zero()) {
+				result -= max_error;
+			}
 			result = result.up_to(max_error_exponent, upper);
 			return result;
 		}
@@ -48,41 +126,38 @@ namespace boost{
 		template<typename T>
 		exact_number<T> logarithm(exact_number<T> x, size_t max_error_exponent, bool upper){
 			// log is only defined for numbers greater than 0
-			static const exact_number<T> two("2");
 			if(x == literals::zero_exact<T> || x.positive == false){
 				throw logarithm_not_defined_for_non_positive_number();
 			}
-			exact_number<T> result("0");
-			exact_number<T> term_number("1");
-			unsigned int term_number_int = 1;
-			exact_number<T> cur_term("0");
-			exact_number<T> x_pow ("1");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> result = literals::zero_exact<T>;
+			T term_number = 1;
+			exact_number<T> cur_term = literals::zero_exact<T>;
+			exact_number<T> x_pow = literals::one_exact<T>;
+			exact_number<T> max_error({1}, -(int) max_error_exponent);
+			const exact_number<T> x_minus_one = x - literals::one_exact<T>;
 			
-			if(x > literals::zero_exact<T> && x < two){
+			if(x > literals::zero_exact<T> && x < literals::two_exact<T>){
 				do{
-					if(term_number_int %2 == 1)
+					if(term_number %2 == 1)
 						result -= cur_term;
 					else 
 						result += cur_term;	
-					x_pow = x_pow * (x - literals::one_exact<T>);
+					x_pow *= x_minus_one;
 					cur_term = x_pow;
-					cur_term.divide_vector(term_number, max_error_exponent, upper);
-					++term_number_int;
-					term_number = term_number + literals::one_exact<T>;
-				}while(cur_term.abs() > max_error);
+					cur_term.divide_by_small(term_number, max_error_exponent, upper);
+					++term_number;
+				}while(exact_number<T>::abs_is_lower(max_error, cur_term));
 				return result;
 			}
 
 			do{
 				result += cur_term;
-				x_pow = x_pow * (x - literals::one_exact<T>);
+				x_pow *= x_minus_one;
 				x_pow.divide_vector(x, max_error_exponent, upper);
 				cur_term = x_pow ;
-				cur_term.divide_vector(term_number, max_error_exponent, upper);
-				++term_number_int;
-				term_number = term_number + literals::one_exact<T>;
-			}while(cur_term.abs() > max_error);
+				cur_term.divide_by_small(term_number, max_error_exponent, upper);
+				++term_number;
+			}while(exact_number<T>::abs_is_lower(max_error, cur_term));
 			result = result.up_to(max_error_exponent, upper);
 			return result;
 		}
@@ -98,30 +173,28 @@ namespace boost{
 		 **/
 		template<typename T>
 		exact_number<T> sine(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("0");
-			exact_number<T> term_number("0");
-			unsigned int term_number_int = 0;
+			exact_number<T> result = literals::zero_exact<T>;
+			T term_number = 0;
 			exact_number<T> cur_term(x);
 			exact_number<T> x_pow(x);
-			exact_number<T> factorial("1");
-			exact_number<T> tmp;
+			exact_number<T> factorial = literals::one_exact<T>;
 			exact_number<T> x_square = x*x;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			static exact_number<T> two("2");
+			exact_number<T> max_error({1}, -(int) max_error_exponent);
 			
 			do{
-				if(term_number_int % 2 == 0){ // if this term is even
+				if(term_number % 2 == 0){ // if this term is even
 					result += cur_term;
 				}
 				else 
 					result -= cur_term; // if this term is odd
-				++term_number_int;
-				term_number = term_number + literals::one_exact<T>;
+				++term_number;
 				x_pow *= x_square; // increasing power by two powers of original x
-				factorial = factorial * ( two * term_number) * ( (two * term_number) + literals::one_exact<T>); // increasing the values of factorial by two
+				// increasing the values of factorial by two, (2k) * (2k + 1)
+				factorial.multiply_by_small(2 * term_number);
+				factorial.multiply_by_small(2 * term_number + 1);
 				cur_term  = x_pow;
 				cur_term.divide_vector(factorial, max_error_exponent, upper);
-			}while(cur_term.abs() > max_error);
+			}while(exact_number<T>::abs_is_lower(max_error, cur_term));
 			result = result.up_to(max_error_exponent, upper);
 			return result;
 		}
@@ -137,31 +210,28 @@ namespace boost{
 		 **/
 		template<typename T>
 		exact_number<T> cosine(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
-			exact_number<T> cur_term("0");
+			exact_number<T> result = literals::one_exact<T>;
+			exact_number<T> cur_term = literals::zero_exact<T>;
 			exact_number<T> square_x = x*x;
-			exact_number<T> cur_power("1");
-			exact_number<T> factorial("1");
-			static exact_number<T> two("2");
-			exact_number<T> term_number("0");
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
-			int term_number_int = 0;
+			exact_number<T> cur_power = literals::one_exact<T>;
+			exact_number<T> factorial = literals::one_exact<T>;
+			exact_number<T> max_error({1}, -(int) max_error_exponent);
+			T term_number = 0;
 			do{
-				if(term_number_int % 2 == 0)
+				if(term_number % 2 == 0)
 					result += cur_term;
 				else 
 					result -= cur_term;
 				
-				for(exact_number<T> i = (two * term_number) + literals::one_exact<T> ; i <= two * (term_number + literals::one_exact<T>); i = i + literals::one_exact<T>){
-					factorial *= i;
-				}
+				// increasing the values of factorial by two, (2k + 1) * (2k + 2)
+				factorial.multiply_by_small(2 * term_number + 1);
+				factorial.multiply_by_small(2 * term_number + 2);
 				cur_power *= square_x;
 				cur_term = cur_power;
 				cur_term.divide_vector(factorial, max_error_exponent, upper);
-				++ term_number_int;
-				term_number = term_number + literals::one_exact<T>;
+				++ term_number;
 				
-			}while(cur_term.abs() > max_error);
+			}while(exact_number<T>::abs_is_lower(max_error, cur_term));
 			result = result.up_to(max_error_exponent, upper);
 			return result;
 		}
@@ -179,16 +249,15 @@ namespace boost{
 		 **/
 		template<typename T>
 		std::tuple<exact_number<T>, exact_number<T> > sin_cos(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> sin_result("0");
-			exact_number<T> cos_result("0");
+			exact_number<T> sin_result = literals::zero_exact<T>;
+			exact_number<T> cos_result = literals::zero_exact<T>;
 			exact_number<T> cur_sin_term = x;
-			exact_number<T> cur_cos_term("1");
+			exact_number<T> cur_cos_term = literals::one_exact<T>;
 			exact_number<T> cur_power = x;
-			exact_number<T> factorial("1");
-			static exact_number<T> two("2");
-			exact_number<T> factorial_number("1");
+			exact_number<T> factorial = literals::one_exact<T>;
+			T factorial_number = 1;
 			unsigned int term_number_int = 0;
-			exact_number<T> max_error(std::vector<T> {1}, -max_error_exponent, true);
+			exact_number<T> max_error({1}, -(int) max_error_exponent);
 			do{
 
 				if(term_number_int % 2 == 0){
@@ -200,18 +269,18 @@ namespace boost{
 					cos_result -= cur_cos_term;
 				}
 				++term_number_int;
-				factorial_number = factorial_number + literals::one_exact<T>;
-				factorial *= factorial_number;
+				++factorial_number;
+				factorial.multiply_by_small(factorial_number);
 				cur_power *= x;
 				cur_cos_term = cur_power;
 				cur_cos_term.divide_vector(factorial, max_error_exponent, upper);
 
-				factorial_number = factorial_number + literals::one_exact<T>;
-				factorial *= factorial_number;
+				++factorial_number;
+				factorial.multiply_by_small(factorial_number);
 				cur_power *= x;
 				cur_sin_term = cur_power;
 				cur_sin_term.divide_vector(factorial, max_error_exponent, upper);
-			}while( (cur_cos_term.abs() > max_error) || (cur_sin_term.abs() > max_error) );
+			}while(exact_number<T>::abs_is_lower(max_error, cur_cos_term) || exact_number<T>::abs_is_lower(max_error, cur_sin_term));
 
 			return std::make_tuple(sin_result, cos_result);
 		}
@@ -261,7 +330,7 @@ namespace boost{
 		 **/
 		template<typename T>
 		inline exact_number<T> secant(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
+			exact_number<T> result = literals::one_exact<T>;
 			exact_number<T> cos = cosine(x, max_error_exponent, upper);
 			result.divide_vector(cos, max_error_exponent, upper);
 			result = result.up_to(max_error_exponent, upper);
@@ -279,7 +348,7 @@ namespace boost{
 		 **/
 		template<typename T>
 		inline exact_number<T> cosecant(exact_number<T> x, size_t max_error_exponent, bool upper){
-			exact_number<T> result("1");
+			exact_number<T> result = literals::one_exact<T>;
 			exact_number<T> sin = sine(x, max_error_exponent, upper);
 			result.divide_vector(sin, max_error_exponent, upper);
 			result = result.up_to(max_error_exponent, upper);
@@ -2,6 +2,7 @@
 #define BOOST_REAL_RATIONAL_NUMBER
 
 #include<real/integer_number.hpp>
+#include<real/algorithm_thresholds.hpp>
 #include<string_view>
 
 namespace boost{
@@ -11,6 +12,12 @@ namespace boost{
 		 * @author: Vikram Singh Chundawat
 		 * @brief: This representation is used to store rational numbers in form of a/b.
 		 * This will have a and b as integer_numbers.
+		 *
+		 * Sums and products of reduced operands take the gcds of the smaller factors before multiplying, so the
+		 * result is reduced without a gcd of the full numerator and denominator (Henrici). In the lazy mode,
+		 * algorithm_thresholds<T>::get().lazy_rational above zero, results whose numerator and denominator
+		 * have fewer limbs than the threshold in total are not reduced at all; they are reduced once they grow
+		 * past it, or when they are compared or converted to an interval.
 		 */
 		template<typename T = int>
 		struct real_rational{
@@ -20,52 +27,130 @@ namespace boost{
 			integer_number<T> b;
 			bool positive;
 			T BASE;
+			// false while a and b may have a common factor, only the lazy mode leaves it so
+			bool reduced = true;
 
 			// making static const varibles "zero" and "one", which store integers 0 and 1
-			inline static const integer_number<T> zero = integer_number<T>("0");
-			inline static const integer_number<T> one = integer_number<T>("1");
+			inline static const integer_number<T> zero = integer_number<T>(0);
+			inline static const integer_number<T> one = integer_number<T>(1);
 
 			// to simply the representation of rational number
 			// like 4/8 is converted to 1/2
 			void simplify(){
+				reduced = true;
 				if(a == zero){
 					b = one;
 					positive = true;
 					return;
 				}
 				integer_number<T> divider = gcd(abs(a),abs(b));
+				if(divider == one) return;
 				a = a.divide(divider);
 				b = b.divide(divider);
 				return ;
 			}
 
+			// reduces a number the lazy mode left unreduced, before it is observed
+			inline void normalize(){
+				if(!reduced) simplify();
+			}
+
+			// true when the lazy mode leaves a result built from this number and other unreduced
+			bool lazy_result(const integer_number<T> &c, const integer_number<T> &d) const{
+				const size_t threshold = (size_t) std::max(algorithm_thresholds<T>::get().lazy_rational, 0);
+				return a.digits.size() + b.digits.size() + c.digits.size() + d.digits.size() < threshold;
+			}
+
+			/**
+			 * HENRICI SUM
+			 * @brief: a/b + c/d, or a/b - c/d if subtract, for the magnitudes a, b of this number and c, d. With
+			 *         g = gcd(b, d) the sum is (a (d/g) +- c (b/g)) / (b/g) d, and only the gcd of its numerator
+			 *         and g can be left, so two gcds of the smaller factors replace one of the whole result
+			 * @ref: P. Henrici, A subroutine for computations with rational numbers, J. ACM 3(1), 1956
+			 **/
+			void add_fraction(const integer_number<T> &c, const integer_number<T> &d, bool c_reduced, bool subtract){
+				const bool lazy = lazy_result(c, d);
+				if(lazy || !reduced || !c_reduced){
+					a = subtract ? a * d - c * b : a * d + c * b;
+					b = b * d;
+					if(lazy && !(a == zero)) reduced = false;
+					else simplify();
+					return;
+				}
+				integer_number<T> g = gcd(b, d);
+				if(g == one){
+					a = subtract ? a * d - c * b : a * d + c * b;
+					b = b * d;
+					if(a == zero) simplify();
+					return;
+				}
+				const integer_number<T> b_g = b.divide(g);
+				a = subtract ? a * d.divide(g) - c * b_g : a * d.divide(g) + c * b_g;
+				if(a == zero){
+					simplify();
+					return;
+				}
+				const integer_number<T> g2 = gcd(abs(a), g);
+				if(g2 == one){
+					b = b_g * d;
+				}else{
+					a = a.divide(g2);
+					b = b_g * d.divide(g2);
+				}
+			}
+
+			/**
+			 * HENRICI PRODUCT
+			 * @brief: a/b * c/d for the magnitudes a, b of this number and c, d. The factors common to a and d
+			 *         and to c and b are divided out first, so the products are of smaller numbers and the
+			 *         result of reduced operands is reduced
+			 **/
+			void multiply_fraction(const integer_number<T> &c, const integer_number<T> &d, bool c_reduced){
+				const bool lazy = lazy_result(c, d);
+				if(lazy || !reduced || !c_reduced){
+					a = a * c;
+					b = b * d;
+					if(lazy && !(a == zero)) reduced = false;
+					else simplify();
+					return;
+				}
+				if(a == zero || c == zero){
+					a = zero;
+					simplify();
+					return;
+				}
+				const integer_number<T> g1 = gcd(a, d), g2 = gcd(c, b);
+				const integer_number<T> new_a = (g1 == one ? a : a.divide(g1)) * (g2 == one ? c : c.divide(g2));
+				b = (g2 == one ? b : b.divide(g2)) * (g1 == one ? d : d.divide(g1));
+				a = new_a;
+			}
+
 			// to add a rational number to other rational number
 			void add_rational(real_rational<T> other){
-				a *= other.b;
-				other.a *= b;
-				b = b * other.b;
-				a = a + other.a;
-				simplify();
+				add_fraction(other.a, other.b, other.reduced, false);
 				return ;
 			}
 
 			void subtract_rational(real_rational<T> other){
-				a *= other.b;
-				other.a *= b;
-				b = b * other.b;
-				a = a - other.a;
-				simplify();
+				add_fraction(other.a, other.b, other.reduced, true);
 				return ;
 			}
 
 			// to add integer number to rational number
 			void add_integer(integer_number<T> &other)
 			{
+				// b has no factor in common with a + other b when it has none with a
 				a += (other*b);
-				simplify();
+				if(reduced) simplify_if_zero();
+				else simplify();
 				return;
 			}
 
+			// a zero numerator has the denominator one
+			inline void simplify_if_zero(){
+				if(a == zero) simplify();
+			}
+
 			// function to return sign of the rational number
 			inline bool get_positive(){
 				return (positive);
@@ -94,8 +179,11 @@ namespace boost{
 
 			inline bool operator == (const real_rational<T> other) const{
 				// since every number is store in its simplifies form, we simply need to check whether both divisor and 
-				// divident are same or not
-				return (a == other.a && b == other.b && positive == other.positive); 
+				// divident are same or not. The lazy mode may leave them unreduced, those are cross multiplied
+				if(reduced && other.reduced)
+					return (a == other.a && b == other.b && positive == other.positive); 
+				if(a == zero || other.a == zero) return a == zero && other.a == zero;
+				return positive == other.positive && a * other.b == other.a * b;
 			}
 
 			inline bool operator >= (const real_rational<T> other) const{
@@ -112,14 +200,17 @@ namespace boost{
 
 			// overloading comparision operators rational numbers and integers
 			inline bool operator > (const integer_number<T> other) const{
-				real_rational<T> _other(other, integer_number<T>("1"));
+				real_rational<T> _other(other, one);
 				return (*this) > _other;
 			}
 
 			// checking whether our number is equal to some integer or not
 			inline bool operator == (const integer_number<T> other) const{
+				if(!reduced) return (*this) == real_rational<T>(other);
 				if(b != one) return false;
-				return a == other;
+				integer_number<T> value = a;
+				value.positive = positive || a == zero;
+				return value == other;
 			}
 
 			inline bool operator >= (const integer_number<T> other) const{
@@ -206,20 +297,16 @@ namespace boost{
 			}
 
 			real_rational<T> operator *(real_rational<T> other){
-				real_rational<T> result;
-				result.a = a * other.a;
-				result.b = b * other.b;
-				result.simplify();
-				result.positive = !((positive) ^ other.positive);
+				real_rational<T> result = (*this);
+				result.multiply_fraction(other.a, other.b, other.reduced);
+				result.positive = !((positive) ^ other.positive) || result.a == zero;
 				return result;
 			}
 
 			real_rational<T> operator * (integer_number<T> other){
-				real_rational<T> result;
-				result.a = a * other;
-				result.b = b;
-				result.simplify();
-				result.positive = !(positive ^ other.positive);
+				real_rational<T> result = (*this);
+				result.multiply_fraction(abs(other), one, true);
+				result.positive = !(positive ^ other.positive) || result.a == zero;
 				return result;
 			}
 
@@ -246,7 +333,7 @@ namespace boost{
 			}
 			
 			// contructor for integer number, when a and b are provided as real::integer for a/b
-			constexpr explicit real_rational(integer_number<T> _a, integer_number<T> _b = integer_number<T>("1")){
+			constexpr explicit real_rational(integer_number<T> _a, integer_number<T> _b = integer_number<T>(1)){
 				a = abs(_a);
 				b = abs(_b);
 				if(_b==zero)
@@ -298,10 +385,10 @@ namespace boost{
 
 		namespace literals{
 			template<typename T>
-			const real_rational<T> zero_rational = real_rational<T>("0");
+			const real_rational<T> zero_rational = real_rational<T>(literals::zero_integer<T>);
 
 			template<typename T>
-			const real_rational<T> one_rational = real_rational<T>("1");
+			const real_rational<T> one_rational = real_rational<T>(literals::one_integer<T>);
 		}
 
 
@@ -386,6 +473,7 @@ namespace boost{
 		 **/
 		template<typename T>
 		integer_number<T> floor(real_rational<T> num){
+			num.normalize();
 			// if number is of integer type, (a/1), then return a 
 			if(num.b == literals::one_integer<T>){
 				integer_number<T> result(num.a);
@@ -398,7 +486,7 @@ namespace boost{
 				if(num.positive)
 					return literals::zero_integer<T>;
 				else 
-					return integer_number<T>("-1");
+					return integer_number<T>(-1);
 			}
 
 			// now only case left is number is greater than one in magnitude and not an integer type
@@ -424,6 +512,7 @@ namespace boost{
 		 **/
 		template<typename T>
 		integer_number<T> ceil(real_rational<T> num){
+			num.normalize();
 			if(num.b == literals::one_integer<T>){
 				integer_number<T> result(num.a);
 				result.positive = num.positive;
@@ -455,14 +544,14 @@ namespace boost{
 
 		// defining division for different scenarios
 
-		// division of one rational number by another
+		// division of one rational number by another, a product by the reciprocal of b
 		template<typename T>
 		real_rational<T> operator / (real_rational<T> a, real_rational<T> b){
+			if(b.a == literals::zero_integer<T>)
+				throw divide_by_zero();
 			real_rational<T> result = a;
-			result.a *= b.b;
-			result.b *= b.a;
-			result.simplify();
-			result.positive = !(a.positive ^ b.positive);
+			result.multiply_fraction(b.b, b.a, b.reduced);
+			result.positive = !(a.positive ^ b.positive) || result.a == literals::zero_integer<T>;
 			return result;
 		}
 
@@ -475,20 +564,21 @@ namespace boost{
 		// division between rational number and integer and result is a rational number
 		template<typename T>
 		real_rational<T> operator / (real_rational<T> a, integer_number<T> b){
-			a.b *= b;
-			a.simplify();
-			a.positive = !(a.positive ^ b.positive);
+			if(b == literals::zero_integer<T>)
+				throw divide_by_zero();
+			const bool positive = !(a.positive ^ b.positive);
+			a.multiply_fraction(literals::one_integer<T>, abs(b), true);
+			a.positive = positive || a.a == literals::zero_integer<T>;
 			return a;
 		}
 
 		template<typename T>
 		real_rational<T> operator / (integer_number<T> a, real_rational<T> b){
-			real_rational<T> result;
-			result.a = b.b;
-			result.b = b.a;
-			result.a *= a;
-			result.simplify();
-			result.positive = !(a.positive ^ b.positive);
+			if(b.a == literals::zero_integer<T>)
+				throw divide_by_zero();
+			real_rational<T> result(abs(a));
+			result.multiply_fraction(b.b, b.a, b.reduced);
+			result.positive = !(a.positive ^ b.positive) || result.a == literals::zero_integer<T>;
 			return result;
 		}
 
@@ -0,0 +1,459 @@
+#ifndef BOOST_REAL_SMALL_VECTOR_HPP
+#define BOOST_REAL_SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        /**
+         *  @brief: SMALL VECTOR: a sequence container for limbs with the interface of std::vector, which keeps
+         *          up to N elements inline and moves to the heap only when it grows past them. The interval
+         *          bounds of a real tree are a few limbs long, so copying them and computing with them does
+         *          not allocate at all on the common low precision path.
+         *
+         *          The data pointer always points to the first element, inside the inline buffer or the heap
+         *          one, so element access costs the same as with std::vector. The elements need not start at the
+         *          beginning of the buffer: erasing a prefix only moves the data pointer forward, and inserting
+         *          at the front reuses the room it left behind. Trimming leading zeros and prepending a carry
+         *          are then constant time. It converts to and from std::vector and compares equal to one with
+         *          the same elements.
+         *
+         *  @tparam: T: trivially copyable element type, the limbs of exact_number
+         *  @tparam: N: number of elements kept inline
+         */
+        template <typename T, std::size_t N>
+        class small_vector {
+            static_assert(std::is_trivially_copyable<T>::value, "small_vector only holds trivially copyable elements");
+            static_assert(N > 0, "small_vector needs room for at least one inline element");
+
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = T&;
+            using const_reference = const T&;
+            using pointer = T*;
+            using const_pointer = const T*;
+            using iterator = T*;
+            using const_iterator = const T*;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            small_vector() noexcept = default;
+
+            explicit small_vector(size_type count, const T &value = T()) {
+                assign(count, value);
+            }
+
+            template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+            small_vector(InputIt first, InputIt last) {
+                assign(first, last);
+            }
+
+            small_vector(std::initializer_list<T> values) {
+                assign(values.begin(), values.end());
+            }
+
+            small_vector(const std::vector<T> &values) {
+                assign(values.begin(), values.end());
+            }
+
+            small_vector(const small_vector &other) {
+                assign(other.begin(), other.end());
+            }
+
+            small_vector(small_vector &&other) noexcept {
+                steal(other);
+            }
+
+            ~small_vector() {
+                release();
+            }
+
+            small_vector &operator=(const small_vector &other) {
+                if (this != &other) {
+                    assign(other.begin(), other.end());
+                }
+                return *this;
+            }
+
+            small_vector &operator=(small_vector &&other) noexcept {
+                if (this != &other) {
+                    release();
+                    steal(other);
+                }
+                return *this;
+            }
+
+            small_vector &operator=(std::initializer_list<T> values) {
+                assign(values.begin(), values.end());
+                return *this;
+            }
+
+            small_vector &operator=(const std::vector<T> &values) {
+                assign(values.begin(), values.end());
+                return *this;
+            }
+
+            /// copies the elements into a std::vector, for the routines that still take one
+            operator std::vector<T>() const {
+                return std::vector<T>(begin(), end());
+            }
+
+            void assign(size_type count, const T &value) {
+                const T copy = value;
+                _size = 0;
+                _data = buffer();
+                reserve(count);
+                std::fill(_data, _data + count, copy);
+                _size = count;
+            }
+
+            template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+            void assign(InputIt first, InputIt last) {
+                using category = typename std::iterator_traits<InputIt>::iterator_category;
+                if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+                    const size_type count = std::distance(first, last);
+                    if (count > _capacity) {
+                        // the source may be this container, so it is read before the old buffer goes away
+                        small_vector grown;
+                        grown.reserve(count);
+                        std::copy(first, last, grown._data);
+                        grown._size = count;
+                        release();
+                        take_heap(grown);
+                        return;
+                    }
+                    // std::copy handles a source that starts inside this container, ahead of the destination
+                    std::copy(first, last, buffer());
+                    _data = buffer();
+                    _size = count;
+                } else {
+                    clear();
+                    for (; first != last; ++first) {
+                        push_back(*first);
+                    }
+                }
+            }
+
+            void assign(std::initializer_list<T> values) {
+                assign(values.begin(), values.end());
+            }
+
+            iterator begin() noexcept { return _data; }
+            const_iterator begin() const noexcept { return _data; }
+            const_iterator cbegin() const noexcept { return _data; }
+            iterator end() noexcept { return _data + _size; }
+            const_iterator end() const noexcept { return _data + _size; }
+            const_iterator cend() const noexcept { return _data + _size; }
+            reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+            const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+            const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+            reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+            const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+            const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+            size_type size() const noexcept { return _size; }
+            bool empty() const noexcept { return _size == 0; }
+            /// the number of elements it holds without allocating, counted from the first one
+            size_type capacity() const noexcept { return _capacity - front_room(); }
+            size_type max_size() const noexcept { return std::vector<T>().max_size(); }
+
+            /// whether the elements live in the inline buffer
+            bool is_inline() const noexcept { return _heap == nullptr; }
+
+            T* data() noexcept { return _data; }
+            const T* data() const noexcept { return _data; }
+
+            reference operator[](size_type i) { return _data[i]; }
+            const_reference operator[](size_type i) const { return _data[i]; }
+            reference front() { return _data[0]; }
+            const_reference front() const { return _data[0]; }
+            reference back() { return _data[_size - 1]; }
+            const_reference back() const { return _data[_size - 1]; }
+
+            void reserve(size_type count) {
+                if (count <= capacity()) {
+                    return;
+                }
+                if (count <= _capacity) {
+                    // the buffer is large enough once the elements go back to its beginning
+                    std::copy(_data, _data + _size, buffer());
+                    _data = buffer();
+                    return;
+                }
+                relocate(count, 0);
+            }
+
+            void shrink_to_fit() noexcept {}
+
+            void clear() noexcept {
+                _data = buffer();
+                _size = 0;
+            }
+
+            void resize(size_type count) {
+                resize(count, T());
+            }
+
+            void resize(size_type count, const T &value) {
+                if (count > _size) {
+                    const T copy = value;
+                    grow_to(count);
+                    std::fill(_data + _size, _data + count, copy);
+                }
+                _size = count;
+            }
+
+            void push_back(const T &value) {
+                if (_size == capacity()) {
+                    const T copy = value;
+                    grow_to(_size + 1);
+                    _data[_size++] = copy;
+                } else {
+                    _data[_size++] = value;
+                }
+            }
+
+            template <typename... Args>
+            reference emplace_back(Args&&... args) {
+                push_back(T(std::forward<Args>(args)...));
+                return back();
+            }
+
+            void pop_back() {
+                --_size;
+            }
+
+            iterator insert(const_iterator position, const T &value) {
+                return insert(position, size_type(1), value);
+            }
+
+            /// inserts at the front in constant time, while the room left by erased leading elements lasts
+            void push_front(const T &value) {
+                insert(cbegin(), value);
+            }
+
+            iterator insert(const_iterator position, size_type count, const T &value) {
+                const size_type offset = position - _data;
+                const T copy = value;
+                make_gap(offset, count);
+                std::fill(_data + offset, _data + offset + count, copy);
+                return _data + offset;
+            }
+
+            template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+            iterator insert(const_iterator position, InputIt first, InputIt last) {
+                const size_type offset = position - _data;
+                // the range is copied out first, it may point into this container
+                small_vector values(first, last);
+                make_gap(offset, values.size());
+                std::copy(values.begin(), values.end(), _data + offset);
+                return _data + offset;
+            }
+
+            iterator insert(const_iterator position, std::initializer_list<T> values) {
+                return insert(position, values.begin(), values.end());
+            }
+
+            iterator erase(const_iterator position) {
+                return erase(position, position + 1);
+            }
+
+            iterator erase(const_iterator first, const_iterator last) {
+                const size_type offset = first - _data;
+                const size_type count = last - first;
+                if (offset == 0) {
+                    // a prefix is dropped by moving the start of the elements
+                    _data += count;
+                    _size -= count;
+                    return _data;
+                }
+                std::copy(_data + offset + count, _data + _size, _data + offset);
+                _size -= count;
+                return _data + offset;
+            }
+
+            void swap(small_vector &other) noexcept {
+                if (this == &other) {
+                    return;
+                }
+                if (!is_inline() && !other.is_inline()) {
+                    std::swap(_heap, other._heap);
+                    std::swap(_data, other._data);
+                    std::swap(_size, other._size);
+                    std::swap(_capacity, other._capacity);
+                    return;
+                }
+                // an inline side is copied, a heap side hands over its buffer with the room in front of it
+                small_vector temporary;
+                temporary.steal(other);
+                other.steal(*this);
+                steal(temporary);
+            }
+
+        private:
+            T* _heap = nullptr;     // the heap buffer of _capacity elements it owns, null while it uses _inline
+            T* _data = _inline;     // the first element, the start of the buffer plus the room left at the front
+            size_type _size = 0;
+            size_type _capacity = N;
+            T _inline[N];
+
+            /// the storage, the owned heap buffer or the inline one
+            T* buffer() noexcept { return _heap != nullptr ? _heap : _inline; }
+            const T* buffer() const noexcept { return _heap != nullptr ? _heap : _inline; }
+
+            /// the number of free elements in front of the first one
+            size_type front_room() const noexcept {
+                return _data - buffer();
+            }
+
+            /**
+             * frees the heap buffer, if any, and goes back to the inline one. Only _heap is ever deleted, it
+             * never points into _inline, so no path through a swap or a move can free the inline buffer
+             */
+            void release() noexcept {
+                delete[] _heap;
+                _heap = nullptr;
+                _data = _inline;
+                _capacity = N;
+            }
+
+            /// moves the elements to a new heap buffer of count elements, leaving front free elements before them
+            void relocate(size_type count, size_type front) {
+                T* grown = new T[count];
+                std::copy(_data, _data + _size, grown + front);
+                const size_type size = _size;
+                release();
+                _heap = grown;
+                _data = grown + front;
+                _size = size;
+                _capacity = count;
+            }
+
+            /**
+             * takes the elements of other, its heap buffer if it has one, and leaves it empty. *this must not
+             * own a heap buffer, it is released or handed over first
+             */
+            void steal(small_vector &other) noexcept {
+                if (other.is_inline()) {
+                    // the room in front of the elements does not matter inline, they go to the start
+                    std::copy(other._data, other._data + other._size, _inline);
+                    _heap = nullptr;
+                    _data = _inline;
+                    _capacity = N;
+                    _size = other._size;
+                    other._size = 0;
+                } else {
+                    take_heap(other);
+                }
+            }
+
+            /// takes the heap buffer of other, which has one, with its elements, and leaves other empty
+            void take_heap(small_vector &other) noexcept {
+                _heap = other._heap;
+                _data = other._data;
+                _size = other._size;
+                _capacity = other._capacity;
+                other._heap = nullptr;
+                other._data = other._inline;
+                other._size = 0;
+                other._capacity = N;
+            }
+
+            /// grows the capacity geometrically to hold at least count elements
+            void grow_to(size_type count) {
+                if (count > capacity()) {
+                    reserve(count > _capacity ? std::max(count, 2 * _capacity) : count);
+                }
+            }
+
+            /// opens count uninitialized elements at offset
+            void make_gap(size_type offset, size_type count) {
+                if (offset == 0) {
+                    make_front_gap(count);
+                    return;
+                }
+                grow_to(_size + count);
+                std::copy_backward(_data + offset, _data + _size, _data + _size + count);
+                _size += count;
+            }
+
+            /**
+             * opens count uninitialized elements in front of the first one. With no room left at the front,
+             * the elements move to the middle of the buffer, a grown one if needed, so the next insertions
+             * at either end are constant time again.
+             */
+            void make_front_gap(size_type count) {
+                if (count > front_room()) {
+                    const size_type needed = _size + count;
+                    if (needed <= _capacity) {
+                        const size_type front = count + (_capacity - needed) / 2;
+                        T* start = buffer() + front;
+                        // std::copy_backward handles a destination past the source, std::copy one before it
+                        if (start > _data) {
+                            std::copy_backward(_data, _data + _size, start + _size);
+                        } else {
+                            std::copy(_data, _data + _size, start);
+                        }
+                        _data = start;
+                    } else {
+                        const size_type grown = std::max(needed, 2 * _capacity);
+                        relocate(grown, count + (grown - needed) / 2);
+                    }
+                }
+                _data -= count;
+                _size += count;
+            }
+        };
+
+        template <typename T, std::size_t N>
+        bool operator==(const small_vector<T, N> &lhs, const small_vector<T, N> &rhs) {
+            return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        template <typename T, std::size_t N>
+        bool operator!=(const small_vector<T, N> &lhs, const small_vector<T, N> &rhs) {
+            return !(lhs == rhs);
+        }
+
+        template <typename T, std::size_t N>
+        bool operator<(const small_vector<T, N> &lhs, const small_vector<T, N> &rhs) {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        template <typename T, std::size_t N>
+        bool operator==(const small_vector<T, N> &lhs, const std::vector<T> &rhs) {
+            return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        template <typename T, std::size_t N>
+        bool operator==(const std::vector<T> &lhs, const small_vector<T, N> &rhs) {
+            return rhs == lhs;
+        }
+
+        template <typename T, std::size_t N>
+        bool operator!=(const small_vector<T, N> &lhs, const std::vector<T> &rhs) {
+            return !(lhs == rhs);
+        }
+
+        template <typename T, std::size_t N>
+        bool operator!=(const std::vector<T> &lhs, const small_vector<T, N> &rhs) {
+            return !(rhs == lhs);
+        }
+
+        template <typename T, std::size_t N>
+        void swap(small_vector<T, N> &lhs, small_vector<T, N> &rhs) noexcept {
+            lhs.swap(rhs);
+        }
+    }
+}
+
+#endif // BOOST_REAL_SMALL_VECTOR_HPP
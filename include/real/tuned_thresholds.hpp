@@ -0,0 +1,13 @@
+// the exact_number algorithm thresholds measured on this machine, as threshold_defaults specializations.
+// `make real_tuned_thresholds` regenerates this file, limb types without a specialization keep the defaults
+// of algorithm_thresholds.hpp
+#ifndef BOOST_REAL_TUNED_THRESHOLDS_HPP
+#define BOOST_REAL_TUNED_THRESHOLDS_HPP
+
+namespace boost {
+    namespace real {
+
+    }
+}
+
+#endif // BOOST_REAL_TUNED_THRESHOLDS_HPP
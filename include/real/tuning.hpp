@@ -0,0 +1,293 @@
+#ifndef BOOST_REAL_TUNING_HPP
+#define BOOST_REAL_TUNING_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <real/algorithm_thresholds.hpp>
+#include <real/exact_number.hpp>
+#include <real/integer_number.hpp>
+#include <real/real_math.hpp>
+
+namespace boost {
+    namespace real {
+        namespace detail {
+
+            /**
+             *  @brief: n digits below base from a linear congruential generator, the first one not zero. A
+             *          quarter of them are zeros and a quarter are base - 1, so the runs of both reach the
+             *          carry and borrow paths of the products and divisions they are fed to.
+             */
+            template <typename T>
+            std::vector<T> tuning_digits(int n, unsigned long long seed, T base = limb_traits<T>::base) {
+                std::vector<T> digits(n);
+                for (T &digit : digits) {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    switch ((seed >> 33) % 4) {
+                        case 0: digit = 0; break;
+                        case 1: digit = base - 1; break;
+                        default: digit = (T) ((seed >> 11) % (unsigned long long) base);
+                    }
+                }
+                if (!digits.empty() && digits[0] == 0) {
+                    digits[0] = 1;
+                }
+                return digits;
+            }
+
+            /**
+             *  @brief: the time of a call of f, in seconds. f runs in batches long enough for the clock, the
+             *          batch count doubling until a batch takes a millisecond, and the fastest of three
+             *          batches is kept, which drops most of the noise of the other processes.
+             */
+            template <typename F>
+            double seconds_per_call(F &&f) {
+                using clock = std::chrono::steady_clock;
+                long calls = 1;
+                double best = std::numeric_limits<double>::max();
+                for (int batch = 0; batch < 3;) {
+                    const clock::time_point start = clock::now();
+                    for (long i = 0; i < calls; ++i) {
+                        f();
+                    }
+                    const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+                    if (seconds < 1e-3 && calls < (1L << 24)) {
+                        calls *= 2;
+                        continue;
+                    }
+                    best = std::min(best, seconds / calls);
+                    ++batch;
+                }
+                return best;
+            }
+
+            /**
+             *  @brief: the first length of the sweep from low to high, each length 1/8 above the previous
+             *          one, from which candidate_is_faster(n) holds at two lengths in a row. high if it
+             *          never does.
+             */
+            template <typename Predicate>
+            int find_crossover(int low, int high, Predicate candidate_is_faster) {
+                bool previous = false;
+                int previous_length = low;
+                for (int n = low; n <= high; n = std::max(n + 1, n + n / 8)) {
+                    const bool faster = candidate_is_faster(n);
+                    if (faster && previous) {
+                        return previous_length;
+                    }
+                    previous = faster;
+                    previous_length = n;
+                }
+                return high;
+            }
+        }
+
+        /**
+         *  @brief: TUNING: measures the crossovers of exact_number<T> on this machine, stores them in
+         *          algorithm_thresholds<T> and returns them. Every crossover times the two algorithms on
+         *          operands of the same random limbs, the thresholds found first fixing the algorithms
+         *          below the next one:
+         *
+         *              schoolbook -> karatsuba, for products and for squares
+         *              karatsuba -> toom-3 -> toom-4 -> NTT
+         *              schoolbook -> chunked karatsuba -> NTT, for operands of very different lengths
+         *              knuth division -> burnikel-ziegler -> newton division
+         *              exponential series term by term -> by binary splitting
+         *              integer gcd by lehmer steps -> by the half gcd
+         *
+         *          Tuning takes a few seconds, a program can call it once at startup, or the real_tune
+         *          target can write the results in tuned_thresholds.hpp.
+         *  @param: max_length: the longest operand, in limbs, a crossover is searched up to
+         */
+        template <typename T>
+        threshold_set tune_thresholds(int max_length = 16000) {
+            using thresholds = algorithm_thresholds<T>;
+            const T base = limb_traits<T>::base;
+            const int never = std::numeric_limits<int>::max();
+
+            threshold_set tuned = thresholds::get();
+            tuned.toom_3 = tuned.toom_4 = tuned.ntt = tuned.ntt_unbalanced = tuned.newton_division = never;
+            thresholds::set(tuned);
+
+            auto operand = [](int n, unsigned long long seed) {
+                return exact_number<T>(detail::tuning_digits<T>(n, seed), n, true);
+            };
+
+            // times multiply_vector on operands of n and m limbs with the thresholds set by configure
+            auto unbalanced_product_time = [&](int n, int m, auto configure) {
+                const exact_number<T> a = operand(n, 1), b = operand(m, 2);
+                std::vector<T> scratch;
+                threshold_set trial = tuned;
+                configure(trial);
+                thresholds::set(trial);
+                const double seconds = detail::seconds_per_call([&]() {
+                    exact_number<T> product = a;
+                    product.multiply_vector(b, scratch, base);
+                });
+                thresholds::set(tuned);
+                return seconds;
+            };
+            auto product_time = [&](int n, auto configure) {
+                return unbalanced_product_time(n, n, configure);
+            };
+
+            // times square on an n limb operand with the thresholds set by configure
+            auto square_time = [&](int n, auto configure) {
+                const exact_number<T> a = operand(n, 3);
+                std::vector<T> scratch;
+                threshold_set trial = tuned;
+                configure(trial);
+                thresholds::set(trial);
+                const double seconds = detail::seconds_per_call([&]() {
+                    exact_number<T> square = a;
+                    square.square(scratch, base);
+                });
+                thresholds::set(tuned);
+                return seconds;
+            };
+
+            // times the division of a 2n limb dividend by an n limb divisor
+            auto division_time = [&](int n, auto configure, bool newton) {
+                const std::vector<T> dividend = detail::tuning_digits<T>(2 * n, 4);
+                const std::vector<T> divisor = detail::tuning_digits<T>(n, 5);
+                std::vector<T> quotient, remainder;
+                threshold_set trial = tuned;
+                configure(trial);
+                thresholds::set(trial);
+                const double seconds = detail::seconds_per_call([&]() {
+                    if (newton) {
+                        exact_number<T>::newton_division(dividend, divisor, quotient, base);
+                    } else {
+                        exact_number<T>::knuth_division(dividend, divisor, quotient, remainder, base);
+                    }
+                });
+                thresholds::set(tuned);
+                return seconds;
+            };
+
+            // times the exponential of an n limb number below one to n limbs after the point
+            auto series_time = [&](int n, auto configure) {
+                const exact_number<T> x(detail::tuning_digits<T>(n, 6), 0, true);
+                threshold_set trial = tuned;
+                configure(trial);
+                thresholds::set(trial);
+                const double seconds = detail::seconds_per_call([&]() {
+                    exponent(x, n, true);
+                });
+                thresholds::set(tuned);
+                return seconds;
+            };
+
+            // a length at or below the karatsuba thresholds is multiplied by the schoolbook product, half of
+            // it is a single karatsuba step over schoolbook halves
+            tuned.karatsuba_base_case = detail::find_crossover(4, std::min(max_length, 512), [&](int n) {
+                return product_time(n, [n](threshold_set &t) { t.karatsuba_base_case = n / 2; }) <
+                       product_time(n, [n](threshold_set &t) { t.karatsuba_base_case = n; });
+            });
+            tuned.karatsuba_square = detail::find_crossover(4, std::min(max_length, 512), [&](int n) {
+                return square_time(n, [n](threshold_set &t) { t.karatsuba_square = n / 2; }) <
+                       square_time(n, [n](threshold_set &t) { t.karatsuba_square = n; });
+            });
+
+            const int toom_low = std::min(max_length, 2 * tuned.karatsuba_base_case);
+            tuned.toom_3 = detail::find_crossover(toom_low, max_length, [&](int n) {
+                return product_time(n, [n](threshold_set &t) { t.toom_3 = n; }) <
+                       product_time(n, [n](threshold_set &t) { t.toom_3 = n + 1; });
+            });
+            tuned.toom_4 = detail::find_crossover(tuned.toom_3, max_length, [&](int n) {
+                return product_time(n, [n](threshold_set &t) { t.toom_4 = n; }) <
+                       product_time(n, [n](threshold_set &t) { t.toom_4 = n + 1; });
+            });
+            tuned.ntt = detail::find_crossover(toom_low, max_length, [&](int n) {
+                return product_time(n, [n](threshold_set &t) { t.ntt = n; }) <
+                       product_time(n, [n](threshold_set &t) { t.ntt = n + 1; });
+            });
+            if (tuned.ntt == max_length) {
+                tuned.ntt = never;
+            }
+            if (tuned.toom_4 == max_length) {
+                tuned.toom_4 = never;
+            }
+            if (tuned.toom_3 == max_length) {
+                tuned.toom_3 = never;
+            }
+
+            // the shorter of two operands in a 1 : 4 ratio, from which chunked karatsuba beats the
+            // schoolbook product and the transform beats the chunks
+            tuned.karatsuba_unbalanced = detail::find_crossover(tuned.karatsuba_base_case + 1, std::min(max_length, 512), [&](int n) {
+                return unbalanced_product_time(n, 4 * n, [n](threshold_set &t) { t.karatsuba_unbalanced = n; }) <
+                       unbalanced_product_time(n, 4 * n, [n](threshold_set &t) { t.karatsuba_unbalanced = n + 1; });
+            });
+            tuned.ntt_unbalanced = detail::find_crossover(tuned.karatsuba_unbalanced, max_length / 4, [&](int n) {
+                return unbalanced_product_time(n, 4 * n, [n](threshold_set &t) { t.ntt_unbalanced = n; }) <
+                       unbalanced_product_time(n, 4 * n, [n](threshold_set &t) { t.ntt_unbalanced = n + 1; });
+            });
+            if (tuned.ntt_unbalanced == max_length / 4) {
+                tuned.ntt_unbalanced = never;
+            }
+
+            // burnikel_ziegler divides a divisor of n limbs or more recursively, down to halves below it
+            tuned.burnikel_ziegler = detail::find_crossover(4, std::min(max_length, 1024), [&](int n) {
+                return division_time(n, [n](threshold_set &t) { t.burnikel_ziegler = n; }, false) <
+                       division_time(n, [n](threshold_set &t) { t.burnikel_ziegler = n + 1; }, false);
+            });
+            tuned.newton_division = detail::find_crossover(std::min(max_length, 2 * tuned.burnikel_ziegler), max_length, [&](int n) {
+                return division_time(n, [](threshold_set &) {}, true) <
+                       division_time(n, [](threshold_set &) {}, false);
+            });
+            if (tuned.newton_division == max_length) {
+                tuned.newton_division = never;
+            }
+
+            // the precision, in limbs, from which binary splitting sums the exponential series faster
+            tuned.binary_splitting = detail::find_crossover(1, std::min(max_length, 64), [&](int n) {
+                return series_time(n, [n](threshold_set &t) { t.binary_splitting = n; }) <
+                       series_time(n, [n](threshold_set &t) { t.binary_splitting = n + 1; });
+            });
+
+            // times the gcd of two integers of n limbs, built from the same random limbs below their base
+            auto gcd_time = [&](int n, auto configure) {
+                const integer_number<T> a(detail::tuning_digits<T>(n, 7));
+                const integer_number<T> b(detail::tuning_digits<T>(n, 8));
+                threshold_set trial = tuned;
+                configure(trial);
+                thresholds::set(trial);
+                const double seconds = detail::seconds_per_call([&]() {
+                    gcd(a, b);
+                });
+                thresholds::set(tuned);
+                return seconds;
+            };
+
+            // the length, in limbs, from which the half gcd beats the lehmer steps
+            tuned.half_gcd = detail::find_crossover(16, std::min(max_length, 1024), [&](int n) {
+                return gcd_time(n, [n](threshold_set &t) { t.half_gcd = n / 2; }) <
+                       gcd_time(n, [](threshold_set &t) { t.half_gcd = std::numeric_limits<int>::max(); });
+            });
+
+            thresholds::set(tuned);
+            return tuned;
+        }
+
+        /**
+         *  @brief: writes the specialization of threshold_defaults of the limb type type_name with the
+         *          given thresholds, the body of the header the real_tune target emits
+         */
+        inline void write_threshold_defaults(std::ostream &out, const std::string &type_name, const threshold_set &t) {
+            out << "        template <>\n"
+                << "        struct threshold_defaults<" << type_name << "> {\n"
+                << "            static threshold_set get() {\n"
+                << "                return {" << t.karatsuba_base_case << ", " << t.karatsuba_square << ", "
+                << t.karatsuba_unbalanced << ", " << t.toom_3 << ", " << t.toom_4 << ", " << t.ntt << ", "
+                << t.ntt_unbalanced << ", " << t.burnikel_ziegler << ", " << t.newton_division << ", "
+                << t.binary_splitting << ", " << t.half_gcd << ", " << t.lazy_rational << "};\n"
+                << "            }\n"
+                << "        };\n";
+        }
+    }
+}
+
+#endif // BOOST_REAL_TUNING_HPP
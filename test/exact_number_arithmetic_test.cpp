@@ -0,0 +1,1085 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <real/tuning.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("exact_number addition and subtraction kernels", "[template]", int, long, long long) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType max_digit = boost::real::limb_traits<TestType>::max_digit;
+
+    SECTION("carry propagates through every digit") {
+        exact_number a(std::vector<TestType>(50, max_digit), 50);
+        exact_number b(std::vector<TestType> {1}, 1);
+
+        a.add_vector(b);
+
+        CHECK(a.exponent == 51);
+        CHECK(a.digits == std::vector<TestType> {1});
+    }
+
+    SECTION("borrow propagates through every digit") {
+        std::vector<TestType> power(51, 0);
+        power[0] = 1;
+        exact_number a(power, 51);
+        exact_number b(std::vector<TestType> {1}, 1);
+
+        a.subtract_vector(b);
+
+        CHECK(a.exponent == 50);
+        CHECK(a.digits == std::vector<TestType>(50, max_digit));
+    }
+
+    SECTION("aligned operands") {
+        exact_number a(std::vector<TestType> {1, 2, max_digit}, 1);
+        exact_number b(std::vector<TestType> {max_digit, 3, 1}, 1);
+
+        exact_number sum = a;
+        sum.add_vector(b);
+        CHECK(sum.exponent == 2);
+        CHECK(sum.digits == std::vector<TestType> {1, 0, 6});
+
+        sum.subtract_vector(b);
+        CHECK(sum.exponent == a.exponent);
+        CHECK(sum.digits == a.digits);
+    }
+
+    SECTION("operands with disjoint digit positions") {
+        exact_number a(std::vector<TestType> {7}, 3);
+        exact_number b(std::vector<TestType> {5}, -2);
+
+        exact_number sum = a;
+        sum.add_vector(b);
+        CHECK(sum.exponent == 3);
+        CHECK(sum.digits == std::vector<TestType> {7, 0, 0, 0, 0, 5});
+
+        exact_number difference = a;
+        difference.subtract_vector(b);
+        CHECK(difference.exponent == 3);
+        CHECK(difference.digits == std::vector<TestType> {6, max_digit, max_digit, max_digit, max_digit, max_digit - 4});
+    }
+
+    SECTION("subtracting equal numbers gives zero") {
+        exact_number a(std::vector<TestType> {3, 1, 4, 1, 5}, 2);
+        exact_number b = a;
+
+        a.subtract_vector(b);
+        CHECK(a.digits == std::vector<TestType> {0});
+        CHECK(a.exponent == 0);
+    }
+
+    SECTION("decimal base") {
+        exact_number a(std::vector<TestType> {9, 9, 9}, 3);
+        exact_number b(std::vector<TestType> {1}, 1);
+
+        a.add_vector(b, 9);
+        CHECK(a.digits == std::vector<TestType> {1});
+        CHECK(a.exponent == 4);
+
+        a.subtract_vector(b, 9);
+        CHECK(a.digits == std::vector<TestType> {9, 9, 9});
+        CHECK(a.exponent == 3);
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number multiplication with wide limb products", "[template]", int, int64_t, uint64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    SECTION("limb type has a wide accumulator") {
+        CHECK(boost::real::limb_traits<TestType>::has_wide_type);
+    }
+
+    SECTION("product of two maximal digits") {
+        exact_number a(std::vector<TestType> {base - 1}, 1);
+        exact_number b(std::vector<TestType> {base - 1}, 1);
+
+        a.multiply_vector(b);
+        CHECK(a.exponent == 2);
+        CHECK(a.digits == std::vector<TestType> {base - 2, 1});
+    }
+
+    SECTION("fractional operands") {
+        exact_number a(std::vector<TestType> {base - 1, base - 1}, 1);
+        exact_number b(std::vector<TestType> {2}, -1);
+
+        a.multiply_vector(b);
+        CHECK(a.exponent == 0);
+        CHECK(a.digits == std::vector<TestType> {1, base - 1, base - 2});
+    }
+
+    SECTION("squaring base^n - 1 above the karatsuba threshold") {
+        const int n = 150;
+        exact_number a(std::vector<TestType>(n, base - 1), n);
+        exact_number b = a;
+
+        const std::vector<TestType> expected = square_of_maximal_digits<TestType>(n);
+
+        a.multiply_vector(b);
+        CHECK(a.exponent == 2 * n);
+        CHECK(a.digits == expected);
+    }
+
+    SECTION("decimal base") {
+        exact_number a(std::vector<TestType> {9, 9, 9}, 3);
+        exact_number b(std::vector<TestType> {9, 9}, 2);
+
+        a.multiply_vector(b, 10);
+        CHECK(a.exponent == 5);
+        CHECK(a.digits == std::vector<TestType> {9, 8, 9, 0, 1});
+    }
+
+    SECTION("division undoes the product") {
+        std::vector<TestType> quotient, remainder;
+        exact_number::knuth_division(std::vector<TestType> {base - 2, 1}, std::vector<TestType> {base - 1}, quotient, remainder);
+
+        CHECK(quotient == std::vector<TestType> {base - 1});
+        CHECK(remainder == std::vector<TestType> {0});
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number toom-cook multiplication", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    SECTION("matches schoolbook multiplication") {
+        for (int k : {3, 4}) {
+            for (auto sizes : std::vector<std::pair<int, int>> {{400, 400}, {401, 350}, {350, 123}}) {
+                exact_number a(digits_of<TestType>(sizes.first, 3 * k), 7, true);
+                exact_number b(digits_of<TestType>(sizes.second, 5 * k), -11, false);
+
+                exact_number expected = a;
+                expected.standard_multiplication(b);
+
+                exact_number result = a;
+                result.toom_cook_multiplication(b, k);
+
+                CHECK(result.positive == expected.positive);
+                CHECK(result.exponent == expected.exponent);
+                CHECK(result.digits == expected.digits);
+            }
+        }
+    }
+
+    SECTION("decimal base") {
+        exact_number a(std::vector<TestType>(60, 9), 60);
+        exact_number b(std::vector<TestType>(45, 9), 45);
+
+        exact_number expected = a;
+        expected.standard_multiplication(b, 10);
+
+        a.toom_cook_multiplication(b, 3, 10);
+        CHECK(a.exponent == expected.exponent);
+        CHECK(a.digits == expected.digits);
+    }
+
+    SECTION("squaring base^n - 1") {
+        const int n = 2007;
+        exact_number a(std::vector<TestType>(n, base - 1), n);
+
+        const std::vector<TestType> expected = square_of_maximal_digits<TestType>(n);
+
+        a.toom_cook_multiplication(a, 4);
+        CHECK(a.exponent == 2 * n);
+        CHECK(a.digits == expected);
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number ntt multiplication", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    SECTION("matches schoolbook multiplication") {
+        for (auto sizes : std::vector<std::pair<int, int>> {{700, 700}, {913, 250}, {64, 1}}) {
+            exact_number a(digits_of<TestType>(sizes.first, 17), 3, false);
+            exact_number b(digits_of<TestType>(sizes.second, 29), -5, false);
+
+            exact_number expected = a;
+            expected.standard_multiplication(b);
+
+            exact_number result = a;
+            result.ntt_multiplication(b);
+
+            CHECK(result.positive == expected.positive);
+            CHECK(result.exponent == expected.exponent);
+            CHECK(result.digits == expected.digits);
+        }
+    }
+
+    SECTION("decimal base") {
+        exact_number a(std::vector<TestType>(300, 9), 300);
+        exact_number b(std::vector<TestType>(200, 9), 0);
+
+        exact_number expected = a;
+        expected.standard_multiplication(b, 10);
+
+        a.ntt_multiplication(b, 10);
+        CHECK(a.exponent == expected.exponent);
+        CHECK(a.digits == expected.digits);
+    }
+
+    SECTION("squaring base^n - 1 above the ntt threshold") {
+        const int n = boost::real::algorithm_thresholds<TestType>::get().ntt * 3;
+        exact_number a(std::vector<TestType>(n, base - 1), n);
+
+        const std::vector<TestType> expected = square_of_maximal_digits<TestType>(n);
+
+        a.multiply_vector(a);
+        CHECK(a.exponent == 2 * n);
+        CHECK(a.digits == expected);
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number multiplication tiers", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    using algorithm = typename exact_number::multiplication_algorithm;
+    const boost::real::threshold_set &thresholds = boost::real::algorithm_thresholds<TestType>::get();
+    const size_t toom_3 = thresholds.toom_3;
+    const size_t toom_4 = thresholds.toom_4;
+    const size_t ntt = thresholds.ntt;
+
+    SECTION("the thresholds are ordered") {
+        CHECK(thresholds.karatsuba_base_case < thresholds.toom_3);
+        CHECK(toom_3 < toom_4);
+        CHECK(toom_4 < ntt);
+    }
+
+    SECTION("every tier is reached") {
+        CHECK(exact_number::select_multiplication(toom_3 - 1, toom_3 - 1, true) == algorithm::karatsuba);
+        CHECK(exact_number::select_multiplication(toom_3, toom_3, true) == algorithm::toom_3);
+        CHECK(exact_number::select_multiplication(toom_4 - 1, toom_4 - 1, true) == algorithm::toom_3);
+        CHECK(exact_number::select_multiplication(toom_4, toom_4, true) == algorithm::toom_4);
+        CHECK(exact_number::select_multiplication(ntt - 1, ntt - 1, true) == algorithm::toom_4);
+        CHECK(exact_number::select_multiplication(ntt, ntt, true) == algorithm::ntt);
+
+        // without enough primes for the transform, toom-4 is the last tier
+        CHECK(exact_number::select_multiplication(4 * ntt, 4 * ntt, false) == algorithm::toom_4);
+
+        // unbalanced operands go by the shorter one
+        CHECK(exact_number::select_multiplication(4 * ntt, toom_3, false) == algorithm::karatsuba);
+        CHECK(exact_number::select_multiplication(4 * ntt, thresholds.ntt_unbalanced, true) == algorithm::ntt);
+    }
+
+    SECTION("every tier multiplies like karatsuba") {
+        const TestType base = boost::real::limb_traits<TestType>::base;
+        for (size_t n : {toom_3, toom_4, ntt}) {
+            exact_number a(std::vector<TestType>(n, base - 1), (int) n);
+            exact_number b(std::vector<TestType>(n - 1, base / 3), 2, false);
+
+            exact_number expected = a;
+            std::vector<TestType> scratch;
+            expected.karatsuba_multiplication(b, scratch, base);
+
+            a.multiply_vector(b);
+            CHECK(a == expected);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number karatsuba multiplication with a scratch buffer", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+
+    SECTION("matches schoolbook multiplication and reuses the buffer") {
+        std::vector<TestType> scratch;
+        const int n = 4 * boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case + 3;
+        scratch.reserve(exact_number::karatsuba_scratch_size(n));
+        const TestType* buffer = scratch.data();
+
+        for (auto sizes : std::vector<std::pair<int, int>> {{n, n}, {n, n - 17}, {n - 40, n}, {n / 2 + 1, n}}) {
+            exact_number a(digits_of<TestType>(sizes.first, 41), 2, false);
+            exact_number b(digits_of<TestType>(sizes.second, 43), -9, true);
+
+            exact_number expected = a;
+            expected.standard_multiplication(b);
+
+            exact_number result = a;
+            result.karatsuba_multiplication(b, scratch);
+
+            CHECK(result.positive == expected.positive);
+            CHECK(result.exponent == expected.exponent);
+            CHECK(result.digits == expected.digits);
+        }
+        CHECK(scratch.data() == buffer);
+    }
+
+    SECTION("unbalanced operands are multiplied in chunks") {
+        const int n = boost::real::algorithm_thresholds<TestType>::get().karatsuba_unbalanced + 7;
+        for (auto sizes : std::vector<std::pair<int, int>> {{7 * n + 3, n}, {n, 3 * n}, {2 * n + 1, n}, {5 * n, n + 1}}) {
+            exact_number a(digits_of<TestType>(sizes.first, 53), 4, true);
+            exact_number b(digits_of<TestType>(sizes.second, 59), -3, false);
+
+            exact_number expected = a;
+            expected.standard_multiplication(b);
+
+            exact_number result = a;
+            result.karatsuba_multiplication(b);
+            CHECK(result.positive == expected.positive);
+            CHECK(result.exponent == expected.exponent);
+            CHECK(result.digits == expected.digits);
+
+            result = a;
+            result.multiply_vector(b);
+            CHECK(result == expected);
+        }
+    }
+
+    SECTION("operands that are the same object") {
+        const int n = 3 * boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case;
+        exact_number a(digits_of<TestType>(n, 47), n);
+
+        exact_number expected = a;
+        expected.standard_multiplication(expected);
+
+        a.karatsuba_multiplication(a);
+        CHECK(a.exponent == expected.exponent);
+        CHECK(a.digits == expected.digits);
+    }
+
+    SECTION("decimal base") {
+        const int n = 2 * boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case + 1;
+        exact_number a(std::vector<TestType>(n, 9), n);
+        exact_number b(std::vector<TestType>(n, 9), 1);
+
+        exact_number expected = a;
+        expected.standard_multiplication(b, 10);
+
+        a.karatsuba_multiplication(b, 10);
+        CHECK(a.exponent == expected.exponent);
+        CHECK(a.digits == expected.digits);
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number squaring", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    SECTION("matches schoolbook multiplication") {
+        const int threshold = boost::real::algorithm_thresholds<TestType>::get().karatsuba_square;
+        for (int n : {1, 2, 3, threshold, threshold + 1, 4 * threshold + 3, 300}) {
+            exact_number a(digits_of<TestType>(n, 53 + n), 3, false);
+            exact_number b = a;
+
+            exact_number expected = a;
+            expected.standard_multiplication(b);
+
+            a.square();
+            CHECK(a.positive);
+            CHECK(a.exponent == expected.exponent);
+            CHECK(a.digits == expected.digits);
+        }
+    }
+
+    SECTION("all digits at their maximum") {
+        const int n = 5 * boost::real::algorithm_thresholds<TestType>::get().karatsuba_square;
+        exact_number a(std::vector<TestType>(n, base - 1), n);
+        exact_number b = a;
+
+        exact_number expected = a;
+        expected.standard_multiplication(b);
+
+        std::vector<TestType> scratch;
+        a.karatsuba_square(scratch);
+        CHECK(a.exponent == expected.exponent);
+        CHECK(a.digits == expected.digits);
+    }
+
+    SECTION("toom-cook squares") {
+        exact_number a(digits_of<TestType>(600, 59), 100);
+        exact_number b = a;
+
+        exact_number expected = a;
+        expected.karatsuba_multiplication(b);
+
+        for (int k : {3, 4}) {
+            exact_number result = a;
+            result.toom_cook_multiplication(result, k);
+            CHECK(result.exponent == expected.exponent);
+            CHECK(result.digits == expected.digits);
+        }
+    }
+
+    SECTION("products of an object with itself") {
+        exact_number a(digits_of<TestType>(50, 61), 20, false);
+        exact_number b = a;
+
+        exact_number expected = a;
+        expected.standard_multiplication(b);
+
+        exact_number product = a * a;
+        CHECK(product == expected);
+
+        a *= a;
+        CHECK(a == expected);
+    }
+
+    SECTION("decimal base") {
+        const int n = 2 * boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case + 1;
+        exact_number a(std::vector<TestType>(n, 9), n);
+        exact_number b = a;
+
+        exact_number expected = a;
+        expected.standard_multiplication(b, 10);
+
+        a.square(10);
+        CHECK(a.exponent == expected.exponent);
+        CHECK(a.digits == expected.digits);
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number knuth division", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    // checks quotient * divisor + remainder == dividend and remainder < divisor
+    auto check_division = [](const std::vector<TestType> &dividend, const std::vector<TestType> &divisor, TestType base) {
+        std::vector<TestType> quotient, remainder;
+        exact_number::knuth_division(dividend, divisor, quotient, remainder, base);
+        REQUIRE_FALSE(quotient.empty());
+        CHECK(quotient[0] != 0);
+        CHECK((remainder.size() == 1 || remainder[0] != 0));
+
+        std::vector<TestType> product(quotient.size() + divisor.size());
+        exact_number::multiply_basecase(product.data(), quotient.data(), quotient.size(), divisor.data(), divisor.size(), base);
+        exact_number result(product, (int)product.size());
+        exact_number rest(remainder, (int)remainder.size());
+        result.normalize();
+        rest.normalize();
+        result.add_vector(rest, base - 1);
+
+        exact_number expected(dividend, (int)dividend.size());
+        expected.normalize();
+        CHECK(result == expected);
+        CHECK(rest < exact_number(divisor, (int)divisor.size()));
+    };
+
+    SECTION("schoolbook division") {
+        for (auto sizes : std::vector<std::pair<int, int>> {{3, 2}, {5, 2}, {9, 3}, {30, 7}, {40, 20}}) {
+            check_division(digits_of<TestType>(sizes.first, 67, base), digits_of<TestType>(sizes.second, 71, base), base);
+            check_division(digits_of<TestType>(sizes.first, 73, 10), digits_of<TestType>(sizes.second, 79, 10), 10);
+        }
+    }
+
+    SECTION("recursive division") {
+        const int n = 5 * boost::real::algorithm_thresholds<TestType>::get().burnikel_ziegler;
+        for (int dividend_size : {n, n + 1, 2 * n, 2 * n + 3, 5 * n - 1}) {
+            // a leading base - 1 keeps the dividend of n digits above the divisor
+            std::vector<TestType> dividend = digits_of<TestType>(dividend_size, 83, base);
+            dividend[0] = base - 1;
+            check_division(dividend, digits_of<TestType>(n, 89, base), base);
+            check_division(digits_of<TestType>(dividend_size, 97, 10), digits_of<TestType>(n - 1, 101, 10), 10);
+        }
+    }
+
+    SECTION("quotient digits equal to base - 1") {
+        // (base^n - 1) / (base^k - 1) has a quotient with long runs of base - 1
+        const int n = 3 * boost::real::algorithm_thresholds<TestType>::get().burnikel_ziegler;
+        check_division(std::vector<TestType>(3 * n, base - 1), std::vector<TestType>(n + 1, base - 1), base);
+        check_division(std::vector<TestType>(8, base - 1), std::vector<TestType>(3, base - 1), base);
+    }
+
+    SECTION("exact division leaves a zero remainder") {
+        std::vector<TestType> divisor = digits_of<TestType>(3 * boost::real::algorithm_thresholds<TestType>::get().burnikel_ziegler, 103, base);
+        std::vector<TestType> factor = digits_of<TestType>(50, 107, base);
+        std::vector<TestType> dividend(divisor.size() + factor.size());
+        exact_number::multiply_basecase(dividend.data(), divisor.data(), divisor.size(), factor.data(), factor.size(), base);
+
+        std::vector<TestType> quotient, remainder;
+        exact_number::knuth_division(dividend, divisor, quotient, remainder, base);
+        CHECK(quotient == factor);
+        CHECK(remainder == std::vector<TestType> {0});
+    }
+
+    SECTION("dividend lower than the divisor") {
+        std::vector<TestType> quotient, remainder;
+        exact_number::knuth_division(std::vector<TestType> {0, 4, 2}, std::vector<TestType> {5, 0}, quotient, remainder, 10);
+        CHECK(quotient.empty());
+        CHECK(remainder == std::vector<TestType> {4, 2});
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number single digit division", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    // checks the kernel against a division of the two leading digits at every step
+    auto check_division = [](std::vector<TestType> digits, TestType divisor, TestType base) {
+        std::vector<TestType> expected = digits;
+        TestType expected_remainder = 0;
+        for (auto &d : expected) {
+            exact_number::divide_two_by_one(expected_remainder, d, divisor, base, d, expected_remainder);
+        }
+
+        TestType remainder = exact_number::divide_by_digit_in_place(digits.data(), digits.size(), divisor, base);
+        CHECK(digits == expected);
+        CHECK(remainder == expected_remainder);
+    };
+
+    SECTION("reciprocal and power of two divisors") {
+        std::vector<TestType> digits {base - 1, 0, 1, base / 2, base - 2, 12345, base - 1, base - 1};
+        for (TestType divisor : {(TestType) 2, (TestType) 3, (TestType) 64, (TestType) 12345, (TestType) 1 << 29, base / 2 + 1, base - 1}) {
+            check_division(digits, divisor, base);
+        }
+        check_division(std::vector<TestType> {9, 8, 7, 6, 5, 4, 3}, 7, 10);
+        check_division(std::vector<TestType> {9, 8, 7, 6, 5, 4, 3}, 8, 10);
+    }
+
+    SECTION("quotient and remainder vectors") {
+        std::vector<TestType> quotient, remainder;
+        exact_number::division_by_single_digit(std::vector<TestType> {0, 1, 0, 5}, std::vector<TestType> {2}, quotient, remainder);
+        CHECK(quotient == std::vector<TestType> {base / 2, 2});
+        CHECK(remainder == std::vector<TestType> {1});
+
+        quotient.clear();
+        remainder.clear();
+        exact_number::division_by_single_digit(std::vector<TestType> {3}, std::vector<TestType> {4}, quotient, remainder, 10);
+        CHECK(quotient == std::vector<TestType> {0});
+        CHECK(remainder == std::vector<TestType> {3});
+    }
+
+    SECTION("rounded division of a number by a small divisor") {
+        // divide_by_small keeps the digits and the rounding of divide_vector with a one digit divisor
+        const std::vector<exact_number> numbers {
+            exact_number(std::vector<TestType> {base - 1, 17, 0, base / 3, 5}, 2, false),
+            exact_number(std::vector<TestType> {6, 3}, 2, true),
+            exact_number(std::vector<TestType> {1}, -3, true),
+            exact_number(std::vector<TestType> {0, 0, 7, 1, 1, 1, 1, 1, 1}, 0, true),
+        };
+        for (const auto &x : numbers) {
+            for (TestType divisor : {(TestType) 1, (TestType) 2, (TestType) 3, (TestType) 1000, base - 1}) {
+                for (bool upper : {false, true}) {
+                    for (unsigned int max_error_exponent : {1u, 2u, 6u}) {
+                        exact_number quotient = x, expected = x;
+                        quotient.divide_by_small(divisor, max_error_exponent, upper);
+                        expected.divide_vector(exact_number(divisor), max_error_exponent, upper);
+                        CHECK(quotient == expected);
+                    }
+                }
+            }
+        }
+
+        exact_number exact(std::vector<TestType> {6, 3}, 2, true);
+        exact.divide_by_small(3, 1, true);
+        CHECK(exact == exact_number(std::vector<TestType> {2, 1}, 2, true));
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number newton division", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    SECTION("quotient matches knuth_division") {
+        for (auto sizes : std::vector<std::pair<int, int>> {{2, 2}, {5, 2}, {9, 3}, {40, 20}, {150, 60}, {300, 150}}) {
+            std::vector<TestType> dividend = digits_of<TestType>(sizes.first, 109, base);
+            for (TestType leading : {(TestType) 1, (TestType) 3, base / 3, base - 1}) {
+                std::vector<TestType> divisor = digits_of<TestType>(sizes.second, 113, base);
+                divisor[0] = leading;
+
+                std::vector<TestType> expected, remainder, quotient;
+                exact_number::knuth_division(dividend, divisor, expected, remainder, base);
+                bool exact = exact_number::newton_division(dividend, divisor, quotient, base);
+                CHECK(quotient == expected);
+                CHECK(exact == (remainder == std::vector<TestType> {0}));
+            }
+        }
+    }
+
+    SECTION("exact division") {
+        std::vector<TestType> divisor = digits_of<TestType>(40, 127, base);
+        std::vector<TestType> factor = digits_of<TestType>(70, 131, base);
+        std::vector<TestType> dividend(divisor.size() + factor.size());
+        exact_number::multiply_basecase(dividend.data(), divisor.data(), divisor.size(), factor.data(), factor.size(), base);
+        if (dividend[0] == 0) {
+            dividend.erase(dividend.begin());
+        }
+
+        std::vector<TestType> quotient;
+        CHECK(exact_number::newton_division(dividend, divisor, quotient, base));
+        CHECK(quotient == factor);
+    }
+
+    SECTION("divide_vector rounds in the requested direction") {
+        const int threshold = boost::real::algorithm_thresholds<TestType>::get().newton_division;
+        boost::real::algorithm_thresholds<TestType>::get().newton_division = 2;
+
+        exact_number numerator(digits_of<TestType>(30, 137, base), 3, true);
+        exact_number denominator(digits_of<TestType>(25, 139, base), -2, false);
+        const unsigned int precision = 40;
+
+        exact_number lower = numerator, upper = numerator;
+        lower.divide_vector(denominator, precision, false);
+        upper.divide_vector(denominator, precision, true);
+        CHECK_FALSE(lower.positive);
+        CHECK_FALSE(upper.positive);
+
+        // the magnitudes bracket the quotient and are one unit of the last place apart
+        exact_number epsilon(std::vector<TestType> {1}, 1 - (int) precision + numerator.exponent - denominator.exponent, true);
+        exact_number upper_abs = upper.abs(), lower_abs = lower.abs(), numerator_abs = numerator.abs(), denominator_abs = denominator.abs();
+        CHECK(lower_abs * denominator_abs < numerator_abs);
+        CHECK(upper_abs * denominator_abs > numerator_abs);
+        CHECK(upper_abs - lower_abs == epsilon);
+
+        // an exact quotient is returned in both directions
+        exact_number product = numerator * denominator;
+        lower = product;
+        upper = product;
+        lower.divide_vector(denominator, precision, false);
+        upper.divide_vector(denominator, precision, true);
+        CHECK(lower == numerator);
+        CHECK(upper == numerator);
+
+        boost::real::algorithm_thresholds<TestType>::get().newton_division = threshold;
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number vector limb kernels", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+    const bool simd = boost::real::detail::use_simd_kernels();
+
+    // runs kernel with the vector kernels and with the scalar loops, both must give the same digits
+    auto check_kernel = [simd](auto kernel) {
+        boost::real::detail::use_simd_kernels() = simd;
+        auto vector_result = kernel();
+        boost::real::detail::use_simd_kernels() = false;
+        auto scalar_result = kernel();
+        boost::real::detail::use_simd_kernels() = simd;
+        CHECK(vector_result == scalar_result);
+    };
+
+    for (int n : {1, 15, 16, 17, 64, 203}) {
+        for (TestType radix : {base, (TestType) 10}) {
+            std::vector<TestType> a = digits_of<TestType>(n, 151, radix);
+            std::vector<TestType> b = digits_of<TestType>(n, 157, radix);
+            std::vector<TestType> complement = a;
+            for (auto &digit : complement) {
+                digit = radix - 1 - digit;
+            }
+
+            check_kernel([&] {
+                std::vector<TestType> r = a;
+                TestType carry = exact_number::add_in_place(r.data(), b.data(), n, radix - 1);
+                r.push_back(carry);
+                return r;
+            });
+            // carries that run through every digit
+            check_kernel([&] {
+                std::vector<TestType> r = complement;
+                TestType carry = exact_number::add_in_place(r.data(), std::vector<TestType>(n, radix - 1).data(), n, radix - 1);
+                r.push_back(carry);
+                return r;
+            });
+            check_kernel([&] {
+                std::vector<TestType> r = a;
+                TestType borrow = exact_number::subtract_in_place(r.data(), b.data(), n, radix - 1);
+                r.push_back(borrow);
+                return r;
+            });
+            check_kernel([&] {
+                std::vector<TestType> c = a;
+                c[n / 2] = (c[n / 2] + 1) % radix;
+                return std::vector<int> {exact_number::compare_spans(a.data(), n, c.data(), n),
+                                         exact_number::compare_spans(a.data(), n, a.data(), n),
+                                         exact_number::aligned_vectors_is_lower(a, c)};
+            });
+            check_kernel([&] {
+                std::vector<TestType> product(n + n / 2 + 1);
+                exact_number::multiply_basecase(product.data(), a.data(), n, b.data(), n / 2 + 1, radix);
+                return product;
+            });
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number small buffer digit storage", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    using digits_type = typename exact_number::digits_type;
+
+    SECTION("short numbers stay inline and long ones spill to the heap") {
+        digits_type digits;
+        std::vector<TestType> expected;
+        for (int i = 0; i < 40; ++i) {
+            digits.push_back(i);
+            expected.push_back(i);
+            CHECK(digits == expected);
+        }
+        digits.insert(digits.begin(), 2, 7);
+        expected.insert(expected.begin(), 2, 7);
+        digits.erase(digits.begin() + 5, digits.begin() + 9);
+        expected.erase(expected.begin() + 5, expected.begin() + 9);
+        CHECK(digits == expected);
+
+        digits_type short_digits = {1, 2, 3};
+        digits_type copy = digits;
+        copy.swap(short_digits);
+        CHECK(copy == std::vector<TestType> {1, 2, 3});
+        CHECK(short_digits == expected);
+        digits_type moved = std::move(short_digits);
+        CHECK(moved == expected);
+        CHECK(short_digits.empty());
+    }
+
+    SECTION("leading digits are dropped and prepended in place") {
+        if constexpr (!std::is_same<digits_type, std::vector<TestType>>::value) {
+            digits_type digits = {0, 0, 0, 4, 5, 6};
+            const TestType *start = digits.data();
+            digits.erase(digits.begin(), digits.begin() + 3);
+            CHECK(digits.data() == start + 3);
+            digits.push_front(1);
+            CHECK(digits.data() == start + 2);
+            CHECK(digits == std::vector<TestType> {1, 4, 5, 6});
+        }
+
+        // a mix of operations at both ends, checked against std::vector
+        digits_type digits;
+        std::vector<TestType> expected;
+        unsigned long long seed = 7;
+        for (int i = 0; i < 2000; ++i) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            const TestType value = (TestType)((seed >> 40) % 1000);
+            switch ((seed >> 33) % 5) {
+                case 0: digits.insert(digits.begin(), value); expected.insert(expected.begin(), value); break;
+                case 1: digits.push_back(value); expected.push_back(value); break;
+                case 2:
+                    if (!expected.empty()) {
+                        const size_t count = value % expected.size() + 1;
+                        digits.erase(digits.begin(), digits.begin() + count);
+                        expected.erase(expected.begin(), expected.begin() + count);
+                    }
+                    break;
+                case 3: digits.resize(value % 50, 1); expected.resize(value % 50, 1); break;
+                default: digits.insert(digits.begin(), 3, value); expected.insert(expected.begin(), 3, value);
+            }
+            REQUIRE(digits == expected);
+        }
+    }
+
+    SECTION("swapping inline and heap vectors that both have room in front") {
+        using vector_type = boost::real::small_vector<TestType, 8>;
+        auto with_front_room = [](size_t size, size_t room) {
+            vector_type v;
+            for (size_t i = 0; i < size + room; ++i) {
+                v.push_back((TestType) i);
+            }
+            v.erase(v.begin(), v.begin() + room);
+            return v;
+        };
+        auto elements = [](size_t size, size_t room) {
+            std::vector<TestType> expected;
+            for (size_t i = room; i < size + room; ++i) {
+                expected.push_back((TestType) i);
+            }
+            return expected;
+        };
+
+        vector_type inline_digits = with_front_room(4, 3);
+        vector_type heap_digits = with_front_room(30, 5);
+        CHECK(inline_digits.is_inline());
+        CHECK(!heap_digits.is_inline());
+
+        inline_digits.swap(heap_digits);
+        CHECK(inline_digits == elements(30, 5));
+        CHECK(heap_digits == elements(4, 3));
+        CHECK(heap_digits.is_inline());
+        heap_digits.swap(inline_digits);
+        CHECK(inline_digits == elements(4, 3));
+        CHECK(heap_digits == elements(30, 5));
+
+        // both on the heap, then each swapped with itself, and both still grow at the front
+        vector_type other_heap_digits = with_front_room(20, 9);
+        heap_digits.swap(other_heap_digits);
+        heap_digits.swap(heap_digits);
+        inline_digits.swap(inline_digits);
+        CHECK(heap_digits == elements(20, 9));
+        CHECK(other_heap_digits == elements(30, 5));
+        CHECK(inline_digits == elements(4, 3));
+        for (vector_type *v : {&inline_digits, &heap_digits, &other_heap_digits}) {
+            std::vector<TestType> expected(v->begin(), v->end());
+            for (int i = 0; i < 12; ++i) {
+                v->push_front((TestType) i);
+                expected.insert(expected.begin(), (TestType) i);
+            }
+            CHECK(*v == expected);
+        }
+    }
+
+    SECTION("normalize and up_to keep the value") {
+        exact_number a(std::vector<TestType> {0, 0, 1, 2, 3, 0, 0}, 3, true);
+        a.normalize();
+        CHECK(a == exact_number(std::vector<TestType> {1, 2, 3}, 1, true));
+        a.push_front(9);
+        CHECK(a.digits == std::vector<TestType> {9, 1, 2, 3});
+
+        exact_number lower = a.up_to(2, false);
+        exact_number upper = a.up_to(2, true);
+        CHECK(lower.digits.size() == 2);
+        CHECK(upper.digits.size() == 2);
+        CHECK(lower < a);
+        CHECK(a < upper);
+        CHECK(a.up_to(4, true) == a);
+    }
+
+    SECTION("arithmetic gives the same digits across the inline boundary") {
+        exact_number a(std::vector<TestType> (20, 3), 20, true);
+        exact_number b(std::vector<TestType> (3, 5), 3, true);
+        exact_number sum = a + b;
+        CHECK(sum.digits == std::vector<TestType> {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 8, 8});
+        CHECK((sum - b) == a);
+        exact_number product = a;
+        product.standard_multiplication(b);
+        CHECK((a * b) == product);
+        exact_number quotient = product;
+        quotient.divide_vector(b, 25, false);
+        CHECK(quotient == a);
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number in place and fused operations", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+
+    const std::vector<exact_number> numbers = {
+            exact_number("0"), exact_number("1"), exact_number("-1"), exact_number("12.5"),
+            exact_number("-12.5"), exact_number("123456789012345678901234567890.75"),
+            exact_number("-0.000000000000000000000000000000000000000003"), exact_number("7")
+    };
+
+    SECTION("compound assignments and temporaries match the copying operators") {
+        for (const exact_number &a : numbers) {
+            for (const exact_number &b : numbers) {
+                exact_number sum = a;
+                sum += b;
+                CHECK(sum == a + b);
+                CHECK((exact_number(a) + b) == a + b);
+
+                exact_number difference = a;
+                difference -= b;
+                CHECK(difference == a - b);
+                CHECK((exact_number(a) - b) == a - b);
+                CHECK((difference + b) == a);
+
+                exact_number product = a;
+                product *= b;
+                CHECK(product == a * b);
+                CHECK((exact_number(a) * b) == a * b);
+
+                CHECK(exact_number::abs_is_lower(a, b) == (a.abs() < b.abs()));
+            }
+        }
+
+        exact_number x(std::vector<TestType> {3, 25}, 1, true);
+        x += x;
+        CHECK(x == exact_number(std::vector<TestType> {6, 50}, 1, true));
+        x -= x;
+        CHECK(x == exact_number("0"));
+    }
+
+    SECTION("fma and add_mul_small") {
+        for (const exact_number &a : numbers) {
+            for (const exact_number &b : numbers) {
+                exact_number acc("-5.5");
+                boost::real::fma(acc, a, b);
+                CHECK(acc == exact_number("-5.5") + a * b);
+            }
+
+            for (TestType limb : {(TestType) 0, (TestType) 2, (TestType) 1000,
+                                  boost::real::limb_traits<TestType>::max_digit}) {
+                exact_number acc("12.5");
+                boost::real::add_mul_small(acc, a, limb);
+                exact_number factor(std::vector<TestType> {limb}, 1, true);
+                factor.normalize();
+                CHECK(acc == exact_number("12.5") + a * factor);
+            }
+        }
+
+        exact_number x(std::vector<TestType> {2}, 1, true);
+        boost::real::fma(x, x, x);
+        CHECK(x == exact_number(std::vector<TestType> {6}, 1, true));
+        exact_number y(std::vector<TestType> {3}, 1, true);
+        boost::real::add_mul_small(y, y, (TestType) 5);
+        CHECK(y == exact_number(std::vector<TestType> {18}, 1, true));
+    }
+
+    SECTION("fma accumulating in place across zero, on the schoolbook rows and on a full product") {
+        const TestType max_digit = boost::real::limb_traits<TestType>::max_digit;
+        // 3 digits take the schoolbook rows, 40 the product, over the default karatsuba threshold
+        for (size_t n : {(size_t) 3, (size_t) 40}) {
+            std::vector<TestType> a_digits(n), b_digits(n);
+            for (size_t i = 0; i < n; ++i) {
+                a_digits[i] = (TestType) ((i % 3 == 0) ? max_digit : i + 1);
+                b_digits[i] = (TestType) ((i % 2 == 0) ? 0 : max_digit - i);
+            }
+            b_digits[0] = 1;
+            const exact_number a(a_digits, 2, true);
+            const exact_number b(b_digits, -1, false);
+            const exact_number product = a * b;
+            const exact_number tiny(std::vector<TestType> {1}, -(int) (2 * n), true);
+            const exact_number minus_tiny(std::vector<TestType> {1}, -(int) (2 * n), false);
+
+            // -(a * b) + tiny plus a negative product comes out at tiny, minus tiny at -tiny
+            for (const exact_number &offset : {tiny, minus_tiny}) {
+                exact_number acc = offset - product;
+                boost::real::fma(acc, a, b);
+                CHECK(acc == offset);
+            }
+
+            // a positive accumulator pushed below zero and a negative one pushed above it
+            exact_number acc("-3.25");
+            boost::real::fma(acc, a, b);
+            CHECK(acc == exact_number("-3.25") + product);
+            acc = exact_number("3.25");
+            boost::real::fma(acc, b, b);
+            CHECK(acc == exact_number("3.25") + b * b);
+            acc = exact_number("0") - product;
+            boost::real::fma(acc, a, b);
+            CHECK(acc.is_zero());
+
+            for (TestType limb : {(TestType) 1, (TestType) 7, max_digit}) {
+                exact_number factor(std::vector<TestType> {limb}, 1, true);
+                acc = exact_number(std::vector<TestType> {1}, -(int) n, true) - b * factor;
+                boost::real::add_mul_small(acc, b, limb);
+                CHECK(acc == exact_number(std::vector<TestType> {1}, -(int) n, true));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("exact_number truncated multiplication", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+
+    auto number_of = [](int n, unsigned long long seed, int exponent, bool positive) {
+        exact_number number(digits_of<TestType>(n, seed), exponent, positive);
+        number.normalize();
+        return number;
+    };
+
+    const int threshold = boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case;
+    for (int karatsuba_threshold : {threshold, 2}) {
+        boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case = karatsuba_threshold;
+        for (auto sizes : {std::make_pair(1, 1), std::make_pair(3, 2), std::make_pair(7, 7), std::make_pair(40, 3),
+                           std::make_pair(25, 60)}) {
+            for (size_t precision : {1, 2, 5, 9, 30}) {
+                for (bool positive : {true, false}) {
+                    exact_number a = number_of(sizes.first, 31 + precision, 2, positive);
+                    exact_number b = number_of(sizes.second, 37 + precision, -1, true);
+                    exact_number product = a * b;
+
+                    exact_number lower = boost::real::multiply_truncated(a, b, precision, false);
+                    exact_number upper = boost::real::multiply_truncated(a, b, precision, true);
+                    CHECK(lower.digits.size() <= precision);
+                    CHECK(upper.digits.size() <= precision);
+                    CHECK(lower <= product);
+                    CHECK(product <= upper);
+
+                    // the bounds are a few units of their last digit apart
+                    exact_number width = upper - lower;
+                    exact_number ulp(std::vector<TestType> {4}, product.exponent - (int) precision + 1, true);
+                    CHECK(width <= ulp);
+
+                    if (product.digits.size() <= precision) {
+                        CHECK(lower == product);
+                        CHECK(upper == product);
+                    }
+                }
+            }
+        }
+    }
+    boost::real::algorithm_thresholds<TestType>::get().karatsuba_base_case = threshold;
+}
+
+TEMPLATE_TEST_CASE("exact_number integral and limb constructors", "[template]", int, int64_t) {
+    using exact_number = boost::real::exact_number<TestType>;
+    const TestType base = boost::real::limb_traits<TestType>::base;
+
+    CHECK(exact_number(0) == exact_number("0"));
+    CHECK(exact_number(0).digits == std::vector<TestType> {0});
+    CHECK(exact_number(1) == exact_number("1"));
+    CHECK(exact_number(-1) == exact_number("-1"));
+    CHECK(exact_number(8) == boost::real::literals::eight_exact<TestType>);
+    CHECK(exact_number(0u) == boost::real::literals::zero_exact<TestType>);
+
+    // a value of several limbs, and one whose low limb is zero
+    exact_number billion(1000000000);
+    CHECK(exact_number(1000000000000000000LL) == billion * billion);
+    CHECK(exact_number(-1000000000000000000LL) == exact_number(0) - billion * billion);
+
+    exact_number power_of_base(base);
+    CHECK(power_of_base.digits == std::vector<TestType> {1});
+    CHECK(power_of_base.exponent == 2);
+
+    exact_number limbs({1, 2}, 0, false);
+    CHECK(limbs == exact_number(std::vector<TestType> {1, 2}, 0, false));
+}
+
+TEST_CASE("exact_number algorithm thresholds per limb type") {
+    using int_thresholds = boost::real::algorithm_thresholds<int>;
+    using int64_thresholds = boost::real::algorithm_thresholds<int64_t>;
+    const boost::real::threshold_set int_defaults = int_thresholds::get();
+    const boost::real::threshold_set int64_defaults = int64_thresholds::get();
+
+    SECTION("the limb types keep their own thresholds") {
+        int_thresholds::get().karatsuba_base_case = 3;
+        CHECK(int64_thresholds::get().karatsuba_base_case == int64_defaults.karatsuba_base_case);
+        int_thresholds::set(int_defaults);
+        CHECK(int_thresholds::get().karatsuba_base_case == int_defaults.karatsuba_base_case);
+    }
+
+    SECTION("the crossover is the first of two faster lengths in a row") {
+        auto faster_from = [](int length) {
+            return [length](int n) { return n >= length; };
+        };
+        // the sweep steps by an eighth, the crossover is the first length it visits from 40 on
+        const int crossover = boost::real::detail::find_crossover(4, 512, faster_from(40));
+        CHECK(crossover >= 40);
+        CHECK(crossover <= 45);
+        CHECK(boost::real::detail::find_crossover(4, 512, faster_from(1000)) == 512);
+        // a single faster length is noise
+        CHECK(boost::real::detail::find_crossover(4, 64, [](int n) { return n == 10; }) == 64);
+    }
+
+    SECTION("small thresholds keep the products, quotients and series") {
+        // every algorithm whose threshold is set below the operand lengths takes part
+        boost::real::threshold_set small = {4, 4, 6, 16, 24, 32, 12, 6, 20, 1, 8, 0};
+        int_thresholds::set(small);
+
+        const int base = boost::real::limb_traits<int>::base;
+        std::vector<int> a_digits(60), b_digits(45);
+        for (size_t i = 0; i < a_digits.size(); ++i) {
+            a_digits[i] = (int) ((i * 7919 + 13) % base);
+        }
+        for (size_t i = 0; i < b_digits.size(); ++i) {
+            b_digits[i] = (int) ((i * 104729 + 1) % base);
+        }
+        boost::real::exact_number<int> a(a_digits, 60, true), b(b_digits, 45, true);
+        boost::real::exact_number<int> product = a, quotient = a;
+        product.multiply_vector(b);
+        quotient.divide_vector(b, 30, false);
+        const boost::real::exact_number<int> x(std::vector<int> {7, 11, 13}, 0, false);
+        const boost::real::exact_number<int> lower = boost::real::exponent(x, 12, false);
+        const boost::real::exact_number<int> upper = boost::real::exponent(x, 12, true);
+
+        int_thresholds::set(int_defaults);
+        int_thresholds::get().binary_splitting = std::numeric_limits<int>::max();
+        boost::real::exact_number<int> expected = a, expected_quotient = a;
+        expected.standard_multiplication(b);
+        expected_quotient.divide_vector(b, 30, false);
+        CHECK(product == expected);
+        CHECK(quotient == expected_quotient);
+
+        // the binary splitting bounds enclose the term by term ones within two units of the last digit
+        const boost::real::exact_number<int> term_lower = boost::real::exponent(x, 12, false);
+        const boost::real::exact_number<int> term_upper = boost::real::exponent(x, 12, true);
+        const boost::real::exact_number<int> two_ulp(std::vector<int> {2}, -11, true);
+        CHECK(lower <= term_upper);
+        CHECK(term_lower <= upper);
+        CHECK(upper - lower <= two_ulp + two_ulp);
+    }
+
+    SECTION("the tuned header specializes threshold_defaults") {
+        std::ostringstream header;
+        boost::real::write_threshold_defaults(header, "long long", int64_defaults);
+        CHECK(header.str().find("struct threshold_defaults<long long>") != std::string::npos);
+        CHECK(header.str().find("return {" + std::to_string(int64_defaults.karatsuba_base_case) + ", ") != std::string::npos);
+        CHECK(header.str().find(", " + std::to_string(int64_defaults.binary_splitting) + ", " +
+                                std::to_string(int64_defaults.half_gcd) + ", " +
+                                std::to_string(int64_defaults.lazy_rational) + "};") != std::string::npos);
+    }
+    int_thresholds::set(int_defaults);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch.hpp>
+
+#include <real/limb_traits.hpp>
+
+// long long limbs use the power of two radix in this test, long limbs keep the default one
+template <> struct boost::real::radix_policy<long long> { using type = boost::real::binary_radix; };
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("binary radix limb traits") {
+    using binary = boost::real::limb_traits<long long>;
+    using decimal = boost::real::limb_traits<long>;
+
+    CHECK(binary::base == (1LL << 62));
+    CHECK(binary::max_digit == (1LL << 62) - 1);
+    CHECK(binary::binary_base);
+    CHECK(binary::base_bits == 62);
+    CHECK(boost::real::integer_number<long long>::BASE == binary::base);
+
+    CHECK(decimal::base == (std::numeric_limits<long>::max() / 4) * 2);
+    CHECK_FALSE(decimal::binary_base);
+    CHECK(boost::real::integer_number<long>::BASE == decimal::base);
+    CHECK(boost::real::integer_number<long>::BASE == std::numeric_limits<long>::max() / 2 - 1);
+
+    CHECK(boost::real::binary_radix::base<int>() == (1 << 30));
+    CHECK(boost::real::binary_radix::base<unsigned long long>() == (1ULL << 63));
+}
+
+TEMPLATE_TEST_CASE("exact_number power of two scaling", "[template]", long long, long) {
+    using exact = boost::real::exact_number<TestType>;
+    const exact two("2");
+
+    SECTION("scaling matches multiplications by two") {
+        exact x(std::vector<TestType> {5, 7, 11}, 1, true);
+        exact expected = x;
+        for (int bits = 1; bits <= 130; ++bits) {
+            expected = expected * two;
+            exact scaled = x;
+            scaled.scale_by_power_of_two(bits);
+            CHECK(scaled == expected);
+        }
+    }
+
+    SECTION("scaling down and back up is exact") {
+        exact x(std::vector<TestType> {3, 1, 4, 1, 5}, -2, false);
+        for (int bits : {1, 2, 61, 62, 63, 124, 200}) {
+            exact scaled = x;
+            scaled.scale_by_power_of_two(-bits);
+            CHECK(scaled != x);
+            scaled.scale_by_power_of_two(bits);
+            CHECK(scaled == x);
+        }
+    }
+
+    SECTION("a power of two limb shifts by whole digits") {
+        exact one("1");
+        one.scale_by_power_of_two(3 * boost::real::limb_traits<long long>::base_bits);
+        if (boost::real::limb_traits<TestType>::binary_base) {
+            CHECK(one.digits == std::vector<TestType> {1});
+            CHECK(one.exponent == 4);
+        }
+        exact power = exact::binary_exponentiation(two, exact(std::vector<TestType> {186}, 1, true));
+        CHECK(one == power);
+    }
+
+    SECTION("zero stays zero") {
+        exact zero;
+        zero.scale_by_power_of_two(-7);
+        CHECK(zero.is_zero());
+    }
+}
+
+TEMPLATE_TEST_CASE("integer_number with the binary radix", "[template]", long long, long) {
+    using integer = boost::real::integer_number<TestType>;
+    integer a("123456789012345678901234567890");
+    integer b("987654321098765432109876543210");
+
+    CHECK(a + b == integer("1111111110111111111011111111100"));
+    CHECK(b - a == integer("864197532086419753208641975320"));
+    CHECK(a * b == integer("121932631137021795226185032733622923332237463801111263526900"));
+}
+
+TEMPLATE_TEST_CASE("real with the binary radix", "[template]", long long, long) {
+    using real = boost::real::real<TestType>;
+    real a("1.5");
+    real b("3");
+
+    CHECK(a * b == real("4.5"));
+    CHECK(b / a == real("2"));
+    CHECK(b - a == a);
+
+    // a digit whose low 32 bits are zero is not zero
+    boost::real::exact_number<TestType> one("1");
+    boost::real::exact_number<TestType> above_one(std::vector<TestType> {1, (TestType) 1 << 32}, 1, true);
+    CHECK(one < above_one);
+    CHECK(one != above_one);
+}
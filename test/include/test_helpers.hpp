@@ -2,8 +2,10 @@
 #define BOOST_REAL_TEST_HELPERS_HPP
 
 #include <real/real.hpp>
+#include <real/tuning.hpp>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 int BASE = (std::numeric_limits<int>::max() /4)*2;
 
@@ -83,4 +85,20 @@ T two(unsigned int n) {
     return 0;
 }
 
+/* deterministic digits in [0, base), with runs of zeros and of maximal digits, the first one not zero */
+template <typename T>
+std::vector<T> digits_of(int n, unsigned long long seed, T base = boost::real::limb_traits<T>::base) {
+    return boost::real::detail::tuning_digits<T>(n, seed, base);
+}
+
+/* the digits of (base^n - 1)^2 = base^2n - 2 * base^n + 1: n - 1 maximal digits, base - 2, n - 1 zeros and a one */
+template <typename T>
+std::vector<T> square_of_maximal_digits(int n, T base = boost::real::limb_traits<T>::base) {
+    std::vector<T> expected(2 * n, 0);
+    std::fill(expected.begin(), expected.begin() + n - 1, base - 1);
+    expected[n - 1] = base - 2;
+    expected[2 * n - 1] = 1;
+    return expected;
+}
+
 #endif //BOOST_REAL_TEST_HELPERS_HPP
@@ -206,6 +206,32 @@ TEMPLATE_TEST_CASE("MULTIPLICATION TEST","[template]", int, unsigned int, long,
 		c = a*b;
 		CHECK(c==b);
 	}
+
+	SECTION("LONG NUMBERS TAKE THE FAST PRODUCTS"){
+		using thresholds = boost::real::algorithm_thresholds<TestType>;
+		const boost::real::threshold_set defaults = thresholds::get();
+		const TestType base = boost::real::limb_traits<TestType>::base;
+		integer x(digits_of<TestType>(70, 3, base)), y(digits_of<TestType>(45, 5, base));
+		x.digits.push_back(0);
+
+		// every length goes through karatsuba, toom-cook or the NTT with these thresholds
+		for(int ntt : {std::numeric_limits<int>::max(), 32}){
+			boost::real::threshold_set small = defaults;
+			small.karatsuba_base_case = 4;
+			small.karatsuba_square = 4;
+			small.toom_3 = 16;
+			small.toom_4 = 24;
+			small.ntt = ntt;
+			small.ntt_unbalanced = ntt;
+			thresholds::set(small);
+			integer product = x * y, negative_product = (integer(0) - x) * y, square = x * x;
+			thresholds::set(defaults);
+
+			CHECK(product.digits == multiply(x.digits, y.digits, base));
+			CHECK(negative_product == integer(0) - product);
+			CHECK(square.digits == multiply(x.digits, x.digits, base));
+		}
+	}
 }
 
 TEMPLATE_TEST_CASE("REMAINDER OPERATOR TEST","[template]", int, unsigned int, long, unsigned long, long long, unsigned long long){
@@ -240,4 +266,162 @@ TEMPLATE_TEST_CASE("REMAINDER OPERATOR TEST","[template]", int, unsigned int, lo
 		CHECK(c==d);		
 
 	}
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE("Integral Constructor Test", "[template]", int, unsigned int, long , unsigned long, long long, unsigned long long){
+	using integer=boost::real::integer_number<TestType>;
+	CHECK(integer(0) == integer("0"));
+	CHECK(integer(7) == integer("7"));
+	CHECK(integer(-7) == integer("-7"));
+	CHECK(integer(1000000000000000000LL) == integer("1000000000000000000"));
+	CHECK(integer(-123456789012345LL) == integer("-123456789012345"));
+}
+
+TEMPLATE_TEST_CASE("EXACT NUMBER CONVERSION TEST", "[template]", int, unsigned int, long, unsigned long, long long, unsigned long long){
+	using integer = boost::real::integer_number<TestType>;
+	using exact = boost::real::exact_number<TestType>;
+
+	// the limbs go over unchanged, the units zero limbs become the exponent
+	std::vector<TestType> limbs = digits_of<TestType>(20, 29, boost::real::limb_traits<TestType>::base);
+	limbs.back() = 1;
+	integer x(limbs, false);
+	x.digits.push_back(0);
+	x.digits.push_back(0);
+	exact e = x.to_exact_number();
+	CHECK(std::vector<TestType>(e.digits) == limbs);
+	CHECK(e.exponent == 22);
+	CHECK_FALSE(e.positive);
+	CHECK(integer(e) == x);
+
+	CHECK(integer(0).to_exact_number() == exact(std::vector<TestType> {0}, 0, true));
+	CHECK(integer(exact()) == integer(0));
+	CHECK(integer(exact(std::vector<TestType> {0, 3}, 2, true)) == integer(3));
+	CHECK_THROWS_AS(integer(exact(std::vector<TestType> {3, 1}, 1, true)), boost::real::integer_contructor_for_non_integer_type);
+}
+
+TEMPLATE_TEST_CASE("DECIMAL STRING TEST", "[template]", int, unsigned int, long, unsigned long, long long, unsigned long long){
+	using integer = boost::real::integer_number<TestType>;
+
+	std::string high = "", low = "";
+	for(int i = 0; i < 70; ++i){
+		high += "9081726354";
+		low += "1029384756";
+	}
+	std::string zeros(low.size(), '0');
+
+	// the halves of the string and the power of ten between them give the whole number back
+	CHECK(integer(high + low) == integer(high) * integer("1" + zeros) + integer(low));
+	CHECK(integer(high + zeros) == integer(high) * integer("1e" + std::to_string(zeros.size())));
+	CHECK(integer("-" + high + low) == integer(0) - integer(high + low));
+	CHECK(integer("000" + low) == integer(low));
+	CHECK(integer(std::string(40, '9')) + integer(1) == integer("1e40"));
+}
+
+TEMPLATE_TEST_CASE("INTEGER ROOT TEST", "[template]", int, unsigned int, long, unsigned long, long long, unsigned long long){
+	using integer = boost::real::integer_number<TestType>;
+	const TestType base = boost::real::limb_traits<TestType>::base;
+
+	SECTION("SMALL NUMBERS AND SIGNS"){
+		CHECK(boost::real::isqrt(integer(0)) == integer(0));
+		CHECK(boost::real::isqrt(integer(1)) == integer(1));
+		CHECK(boost::real::isqrt(integer(15)) == integer(3));
+		CHECK(boost::real::isqrt(integer(16)) == integer(4));
+		CHECK(boost::real::iroot(integer(-27), 3) == integer(-3));
+		CHECK(boost::real::iroot(integer(1000), 1) == integer(1000));
+		CHECK(boost::real::iroot(integer(1000), 100) == integer(1));
+		CHECK(boost::real::ipow(integer(-3), 3) == integer(-27));
+		CHECK_THROWS_AS(boost::real::isqrt(integer(-4)), boost::real::non_integral_power_of_negative_number);
+	}
+
+	SECTION("THE ROOT IS THE FLOOR FOR EVERY LENGTH"){
+		// lengths below a word, at the first recursion and a few levels deep
+		for(int length : {1, 3, 5, 12, 40, 130}){
+			integer x(digits_of<TestType>(length, length, base));
+			for(unsigned int n : {2u, 3u, 5u}){
+				integer root = boost::real::iroot(x, n);
+				CHECK(boost::real::ipow(root, n) <= x);
+				CHECK(boost::real::ipow(root + integer(1), n) > x);
+			}
+		}
+	}
+
+	SECTION("EXACT POWERS"){
+		integer y(digits_of<TestType>(25, 31, base));
+		CHECK(boost::real::isqrt(y * y) == y);
+		CHECK(boost::real::isqrt(y * y - integer(1)) == y - integer(1));
+		CHECK(boost::real::iroot(boost::real::ipow(y, 7), 7) == y);
+	}
+}
+
+TEMPLATE_TEST_CASE("GCD TEST", "[template]", int, unsigned int, long, unsigned long, long long, unsigned long long){
+	using integer = boost::real::integer_number<TestType>;
+	const TestType base = boost::real::limb_traits<TestType>::base;
+
+	SECTION("SMALL NUMBERS, SIGNS AND ZERO"){
+		CHECK(boost::real::gcd(integer("12"), integer("18")) == integer("6"));
+		CHECK(boost::real::gcd(integer("-12"), integer("18")) == integer("6"));
+		CHECK(boost::real::gcd(integer("12"), integer("-18")) == integer("6"));
+		CHECK(boost::real::gcd(integer("0"), integer("5")) == integer("5"));
+		CHECK(boost::real::gcd(integer("5"), integer("0")) == integer("5"));
+		CHECK(boost::real::gcd(integer("17"), integer("17")) == integer("17"));
+		CHECK(boost::real::lcm(integer("4"), integer("6")) == integer("12"));
+	}
+
+	SECTION("A COMMON FACTOR OF MANY LIMBS"){
+		integer g("123456789012345678901234567891");
+		integer p("100000000000000000000000000000000000000000000000000000000000000000000007");
+		integer q = p + integer(1);
+		CHECK(boost::real::gcd(p * g, q * g) == g);
+		CHECK(boost::real::gcd(p * g * g, q * g) == g);
+		CHECK(boost::real::gcd(p * g, integer("0") - q * g) == g);
+	}
+
+	SECTION("CONSECUTIVE FIBONACCI NUMBERS ARE COPRIME"){
+		// every euclid quotient is one, the longest run of steps for the length
+		integer a(1), b(1);
+		for(int i = 0; i < 400; ++i){
+			integer c = a + b;
+			a = b;
+			b = c;
+		}
+		CHECK(boost::real::gcd(a, b) == integer(1));
+		CHECK(boost::real::gcd(b, a) == integer(1));
+	}
+
+	SECTION("THE HALF GCD GIVES THE LEHMER RESULT"){
+		integer g(digits_of<TestType>(7, 11, base));
+		integer x(digits_of<TestType>(90, 13, base));
+		integer y(digits_of<TestType>(85, 17, base));
+		integer a = x * g, b = y * g;
+
+		const int threshold = boost::real::algorithm_thresholds<TestType>::get().half_gcd;
+		boost::real::algorithm_thresholds<TestType>::get().half_gcd = std::numeric_limits<int>::max();
+		integer expected = boost::real::gcd(a, b);
+		boost::real::algorithm_thresholds<TestType>::get().half_gcd = 6;
+		integer result = boost::real::gcd(a, b);
+		boost::real::algorithm_thresholds<TestType>::get().half_gcd = threshold;
+
+		CHECK(result == expected);
+		CHECK(a % result == integer(0));
+		CHECK(b % result == integer(0));
+		CHECK(boost::real::gcd(x, y) * g == result);
+	}
+
+	SECTION("EXTENDED GCD"){
+		std::vector<std::pair<integer, integer>> pairs = {
+			{integer("240"), integer("46")}, {integer("46"), integer("240")}, {integer("-240"), integer("46")},
+			{integer("240"), integer("-46")}, {integer("0"), integer("7")}, {integer("7"), integer("0")},
+			{integer("17"), integer("1")}, {integer(digits_of<TestType>(30, 19, base)), integer(digits_of<TestType>(20, 23, base))}
+		};
+		for(auto &pair : pairs){
+			integer x, y;
+			integer g = boost::real::extended_gcd(pair.first, pair.second, x, y);
+			CHECK(g == boost::real::gcd(pair.first, pair.second));
+			CHECK(pair.first * x + pair.second * y == g);
+		}
+
+		// the inverse of 3 modulo 7 is 5
+		integer x, y;
+		CHECK(boost::real::extended_gcd(integer("3"), integer("7"), x, y) == integer(1));
+		CHECK(x % integer("7") == integer("5"));
+	}
+}
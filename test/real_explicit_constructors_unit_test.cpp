@@ -82,4 +82,31 @@ TEST_CASE("Create boost::real_explicit from strings") {
     SECTION("Invalid string") {
         //CHECK_THROWS_AS( boost::real::real_explicit a("12e23.2"));
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Create boost::real_explicit from long strings") {
+
+    SECTION("Long integers keep every digit") {
+
+        std::string number_str = "";
+        for (int i = 0; i < 300; i++) {
+            number_str += "1234567809";
+            boost::real::real_explicit a(number_str);
+            CHECK( a.as_string() == number_str );
+        }
+    }
+
+    SECTION("Long integers with an exponent") {
+
+        std::string number_str = "98765432100123456789";
+        for (int i = 0; i < 5; i++) {
+            number_str += number_str;
+        }
+        std::string zeros_str(257, '0');
+        boost::real::real_explicit a(number_str + 'e' + std::to_string(zeros_str.size()));
+        boost::real::real_explicit b("-" + number_str + zeros_str);
+        CHECK( a.as_string() == number_str + zeros_str );
+        CHECK( b.as_string() == "-" + number_str + zeros_str );
+        CHECK( a.get_exact_number().digits == b.get_exact_number().digits );
+        CHECK( a.get_exact_number().exponent == b.get_exact_number().exponent );
+    }
+}
@@ -872,6 +872,25 @@ TEST_CASE("SQURE ROOT FUNCTION TEST"){
 		CHECK(result < upper_limit);
 	}
 
+	SECTION("EXACT ROOTS"){
+		// the roots of integer and rational squares stay integers and rationals
+		real result = real::sqrt(real("16"));
+		CHECK(std::holds_alternative<boost::real::real_explicit<int>>(result.get_real_number()));
+		CHECK(result == real("4"));
+
+		result = real::sqrt(real("9/4", TYPE::RATIONAL));
+		CHECK(std::holds_alternative<boost::real::real_rational<int>>(result.get_real_number()));
+		CHECK(result == real("3/2", TYPE::RATIONAL));
+
+		result = real::sqrt(real("152415787532388367504942236884722755800955129"));
+		CHECK(result == real("12345678901234567890123"));
+
+		result = real::sqrt(real("0"));
+		CHECK(result == real("0"));
+
+		CHECK_THROWS_AS(real::sqrt(real("-4")), boost::real::sqrt_not_defined_for_negative_number);
+	}
+
 	SECTION("NUMBER IS AN OPERATION"){
 		SECTION("ADDITION OPERATION"){
 			real a("2");
@@ -566,6 +566,22 @@ TEST_CASE("Non-Integral Power"){
         CHECK(c < upper_bound);
     }
 
+    SECTION("Exact Roots"){
+        using TYPE = boost::real::TYPE;
+        real third("1/3", TYPE::RATIONAL);
+        real c = real::power(real("-27"), third);
+        CHECK(std::holds_alternative<boost::real::real_explicit<int>>(c.get_real_number()));
+        CHECK(c == real("-3"));
+
+        c = real::power(real("8/125", TYPE::RATIONAL), third);
+        CHECK(c == real("2/5", TYPE::RATIONAL));
+
+        // 20 has no exact cube root, the power goes through the logarithm
+        c = real::power(real("20"), third); // 20^(1/3) = 2.7144176165
+        CHECK(c > real("2.7144176164"));
+        CHECK(c < real("2.7144176166"));
+    }
+
     SECTION("POWER IS AN OPERATION"){
         SECTION("POWER IS ADDITION OPERATION(A+B)"){
             real a("1.23");
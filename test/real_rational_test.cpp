@@ -675,4 +675,51 @@ TEMPLATE_TEST_CASE("HELPER FUNCTION TEST", "[template]", int, unsigned int, long
 		CHECK(a==b);
 
 	}
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE("HENRICI AND LAZY REDUCTION TEST", "[template]", int, unsigned int, long, unsigned long, long long, unsigned long long){
+	using rational = boost::real::real_rational<TestType>;
+	using integer = boost::real::integer_number<TestType>;
+	using thresholds = boost::real::algorithm_thresholds<TestType>;
+	const int lazy_rational = thresholds::get().lazy_rational;
+
+	SECTION("CROSS REDUCED PRODUCTS AND QUOTIENTS"){
+		rational c = rational("6/35") * rational("14/15");
+		CHECK(c.a == integer("4"));
+		CHECK(c.b == integer("25"));
+		c = rational("6/35") / rational("15/14");
+		CHECK(c == rational("4/25"));
+		c = rational("-6/35") * integer("35");
+		CHECK(c == integer("-6"));
+		c = rational("5/6") - rational("1/3");
+		CHECK(c.a == integer("1"));
+		CHECK(c.b == integer("2"));
+		c = rational("1/6") - rational("1/6");
+		CHECK(c == integer("0"));
+		CHECK_THROWS_AS(rational("1/2") / rational("0"), boost::real::divide_by_zero);
+	}
+
+	SECTION("HARMONIC SUMS AGREE IN THE EAGER AND THE LAZY MODE"){
+		rational eager;
+		for(int k = 1; k <= 10; ++k)
+			eager += rational(integer(k), integer(1)) / integer(k * k);
+		CHECK(eager.a == integer("7381"));
+		CHECK(eager.b == integer("2520"));
+
+		thresholds::get().lazy_rational = 1000;
+		rational lazy;
+		for(int k = 1; k <= 10; ++k)
+			lazy += rational(integer(1), integer(k));
+		CHECK_FALSE(lazy.reduced);
+		CHECK(lazy == eager);
+		CHECK(lazy > rational("2"));
+		CHECK(floor(lazy) == integer("2"));
+		lazy.normalize();
+		CHECK(lazy.a == integer("7381"));
+		CHECK(lazy.b == integer("2520"));
+
+		rational half = rational("1/2") + rational("1/2");
+		CHECK(half == integer("1"));
+		thresholds::get().lazy_rational = lazy_rational;
+	}
+	thresholds::get().lazy_rational = lazy_rational;
+}
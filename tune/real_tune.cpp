@@ -0,0 +1,36 @@
+#include <fstream>
+#include <iostream>
+#include <real/tuning.hpp>
+
+/** measures the thresholds of the common limb types and writes them as the threshold_defaults
+ *  specializations of tuned_thresholds.hpp, to the file given as argument or to the standard output
+ */
+int main(int argc, char** argv) {
+    std::ofstream file;
+    if (argc > 1) {
+        file.open(argv[1]);
+        if (!file) {
+            std::cerr << "real_tune: cannot write " << argv[1] << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &out = (argc > 1) ? file : std::cout;
+
+    out << "// the exact_number algorithm thresholds measured on this machine, as threshold_defaults specializations.\n"
+        << "// generated by real_tune, `make real_tuned_thresholds` regenerates this file\n"
+        << "#ifndef BOOST_REAL_TUNED_THRESHOLDS_HPP\n"
+        << "#define BOOST_REAL_TUNED_THRESHOLDS_HPP\n\n"
+        << "namespace boost {\n"
+        << "    namespace real {\n\n";
+
+    boost::real::write_threshold_defaults(out, "int", boost::real::tune_thresholds<int>());
+    out << "\n";
+    boost::real::write_threshold_defaults(out, "long", boost::real::tune_thresholds<long>());
+    out << "\n";
+    boost::real::write_threshold_defaults(out, "long long", boost::real::tune_thresholds<long long>());
+
+    out << "    }\n"
+        << "}\n\n"
+        << "#endif // BOOST_REAL_TUNED_THRESHOLDS_HPP\n";
+    return 0;
+}